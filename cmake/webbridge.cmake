@@ -139,33 +139,9 @@ function(webbridge_generate)
 		return()
 	endif()
 
-	# Prepare batch arguments and output files
-	set(batch_args)
-	set(all_output_files)
-	set(all_input_files)
-	
-	foreach(pair ${all_files})
-		# Split pair into file and class_name
-		string(REPLACE "|" ";" parts "${pair}")
-		list(GET parts 0 file)
-		list(GET parts 1 class_name)
-		
-		# Add to batch arguments in format "file|classname"
-		list(APPEND batch_args "${file}|${class_name}")
-		list(APPEND all_input_files ${file})
-		
-		# Collect output files based on LANGUAGE
-		if(arg_LANGUAGE STREQUAL "cpp")
-			list(APPEND all_output_files "${arg_OUTPUT_DIR}/${class_name}_registration.h")
-			list(APPEND all_output_files "${arg_OUTPUT_DIR}/${class_name}_registration.cpp")
-		elseif(arg_LANGUAGE STREQUAL "ts-impl")
-			list(APPEND all_output_files "${arg_OUTPUT_DIR}/${class_name}.ts")
-		endif()
-	endforeach()
-
 	# Determine template files and python args based on LANGUAGE
 	if(arg_LANGUAGE STREQUAL "cpp")
-		set(template_files 
+		set(template_files
 			"${CMAKE_SOURCE_DIR}/tools/templates/registration_header.h.j2"
 			"${CMAKE_SOURCE_DIR}/tools/templates/registration_impl.cpp.j2"
 		)
@@ -177,25 +153,74 @@ function(webbridge_generate)
 		message(FATAL_ERROR "Invalid LANGUAGE: ${arg_LANGUAGE}. Must be 'cpp' or 'ts-impl'")
 	endif()
 
-	# Single batch command for all files
-	list(LENGTH all_files file_count)
-	add_custom_command(
-		OUTPUT ${all_output_files}
-		COMMAND ${Python_EXECUTABLE}
-			${CMAKE_SOURCE_DIR}/tools/generate.py
-			--batch
-			${batch_args}
-			${python_out_arg}
-			${arg_OUTPUT_DIR}
-		DEPENDS
-			${CMAKE_SOURCE_DIR}/tools/generate.py
-			${CMAKE_SOURCE_DIR}/tools/parser.py
-			${CMAKE_SOURCE_DIR}/tools/tstypes.py
-			${template_files}
-			${all_input_files}
-		COMMENT "Generating ${arg_LANGUAGE} (batch of ${file_count} files)"
-		VERBATIM
-	)
+	# One custom command PER class: touching one exposed header
+	# regenerates and recompiles exactly one registration pair instead of
+	# the whole batch, and the build tool runs stale generators in
+	# parallel. generate.py's content-hash cache additionally skips
+	# parse/render when nothing relevant changed, and writes outputs only
+	# on real content changes - so a rerun never retriggers cl.exe.
+	set(class_names)
+	set(all_output_files)
+
+	foreach(pair ${all_files})
+		string(REPLACE "|" ";" parts "${pair}")
+		list(GET parts 0 file)
+		list(GET parts 1 class_name)
+		list(APPEND class_names ${class_name})
+
+		if(arg_LANGUAGE STREQUAL "cpp")
+			set(class_outputs
+				"${arg_OUTPUT_DIR}/${class_name}_registration.h"
+				"${arg_OUTPUT_DIR}/${class_name}_registration.cpp"
+			)
+		else()
+			set(class_outputs "${arg_OUTPUT_DIR}/${class_name}.ts")
+		endif()
+		list(APPEND all_output_files ${class_outputs})
+
+		add_custom_command(
+			OUTPUT ${class_outputs}
+			COMMAND ${Python_EXECUTABLE}
+				${CMAKE_SOURCE_DIR}/tools/generate.py
+				${file}
+				--class-name ${class_name}
+				${python_out_arg}
+				${arg_OUTPUT_DIR}
+			DEPENDS
+				${CMAKE_SOURCE_DIR}/tools/generate.py
+				${CMAKE_SOURCE_DIR}/tools/parser.py
+				${CMAKE_SOURCE_DIR}/tools/tstypes.py
+				${template_files}
+				${file}
+			COMMENT "Generating ${arg_LANGUAGE} registration for ${class_name}"
+			VERBATIM
+		)
+	endforeach()
+
+	# Combined registration bundle (C++ only): depends solely on the
+	# class LIST, which is fixed at configure time - editing a class does
+	# not retrigger it, only adding/removing one does (via reconfigure).
+	if(arg_LANGUAGE STREQUAL "cpp")
+		list(APPEND all_output_files
+			"${arg_OUTPUT_DIR}/webbridge_registration_bundle.h"
+			"${arg_OUTPUT_DIR}/webbridge_registration_bundle.cpp"
+		)
+		add_custom_command(
+			OUTPUT
+				"${arg_OUTPUT_DIR}/webbridge_registration_bundle.h"
+				"${arg_OUTPUT_DIR}/webbridge_registration_bundle.cpp"
+			COMMAND ${Python_EXECUTABLE}
+				${CMAKE_SOURCE_DIR}/tools/generate.py
+				--bundle ${class_names}
+				--cpp_out ${arg_OUTPUT_DIR}
+			DEPENDS
+				${CMAKE_SOURCE_DIR}/tools/generate.py
+				${CMAKE_SOURCE_DIR}/tools/templates/registration_bundle.h.j2
+				${CMAKE_SOURCE_DIR}/tools/templates/registration_bundle.cpp.j2
+			COMMENT "Generating registration bundle"
+			VERBATIM
+		)
+	endif()
 
 	# For C++, add generated files to target and set up include paths
 	if(arg_LANGUAGE STREQUAL "cpp")
@@ -16,6 +16,7 @@ class UsgHostRecipe(ConanFile):
         self.requires("fmt/11.0.2")
         self.requires("argparse/3.1")
         self.requires("nlohmann_json/3.11.3")
+        self.requires("simdjson/3.10.1")
         self.requires("cpp-httplib/0.18.1")
         self.requires("portable-file-dialogs/0.1.0")
 
@@ -0,0 +1,149 @@
+#include "BridgeMetrics.h"
+
+#include "webbridge/impl/dispatcher.h"
+#include "webbridge/impl/object_registry.h"
+#include "webbridge/impl/thread_pool.h"
+#include "webbridge/impl/trace.h"
+
+#include <nlohmann/json.hpp>
+#include <chrono>
+
+using webbridge::impl::bridge_metrics;
+
+namespace {
+
+// Namen der Operation-Slots fürs callsByClass-JSON; Indizes wie in
+// bridge_metrics (0-3 = Sync-Op-Codes, dann async und create)
+constexpr const char* OP_LABELS[bridge_metrics::OP_SLOTS] = {
+	"prop", "const", "call", "snapshot", "async", "create"
+};
+
+} // namespace
+
+BridgeMetrics::BridgeMetrics()
+{
+	m_previous.taken_us = webbridge::impl::trace_now_us();
+	m_sampler = std::thread([this]() { sampler_loop(); });
+}
+
+BridgeMetrics::~BridgeMetrics()
+{
+	{
+		std::lock_guard lock(m_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+	if (m_sampler.joinable()) {
+		m_sampler.join();
+	}
+}
+
+void BridgeMetrics::setSampleInterval(int ms)
+{
+	m_interval_ms.store(ms < 100 ? 100 : ms, std::memory_order_relaxed);
+	m_wake.notify_all();
+}
+
+void BridgeMetrics::sampler_loop()
+{
+	std::unique_lock lock(m_mutex);
+	while (!m_stop) {
+		const auto interval = std::chrono::milliseconds(
+			m_interval_ms.load(std::memory_order_relaxed));
+		if (m_wake.wait_for(lock, interval, [this]() { return m_stop; })) {
+			return;
+		}
+		// Property-Sets außerhalb des eigenen Locks: die on_changed-
+		// Callbacks laufen in den Coalescer, der selbst sperrt
+		lock.unlock();
+		take_sample();
+		lock.lock();
+	}
+}
+
+void BridgeMetrics::take_sample()
+{
+	auto& metrics = bridge_metrics::instance();
+	auto& dispatcher = webbridge::impl::dispatcher_registry::instance();
+
+	counter_sample now;
+	now.taken_us = webbridge::impl::trace_now_us();
+	const auto class_count = dispatcher.class_count();
+	now.calls_by_class.resize(class_count);
+	for (size_t id = 0; id < class_count; ++id) {
+		for (size_t op = 0; op < bridge_metrics::OP_SLOTS; ++op) {
+			now.calls_by_class[id][op] = metrics.call_count(static_cast<uint32_t>(id), op);
+		}
+	}
+	now.sync_buckets = metrics.sync_latency_buckets();
+	now.async_buckets = metrics.async_latency_buckets();
+	now.bytes_in = metrics.bytes_in();
+	now.bytes_out = metrics.bytes_out();
+
+	const auto elapsed_us = now.taken_us - m_previous.taken_us;
+	if (elapsed_us <= 0) {
+		m_previous = std::move(now);
+		return;
+	}
+	const double seconds = static_cast<double>(elapsed_us) / 1e6;
+	const auto rate = [seconds](uint64_t current, uint64_t previous) {
+		return static_cast<double>(current - previous) / seconds;
+	};
+
+	// Raten und Aufschlüsselung pro Klasse/Operation aus den Deltas
+	uint64_t sync_calls = 0;
+	uint64_t async_calls = 0;
+	uint64_t prev_sync = 0;
+	uint64_t prev_async = 0;
+	nlohmann::json breakdown = nlohmann::json::object();
+	for (size_t id = 0; id < class_count; ++id) {
+		const auto& current = now.calls_by_class[id];
+		const std::array<uint64_t, bridge_metrics::OP_SLOTS> previous =
+			id < m_previous.calls_by_class.size() ? m_previous.calls_by_class[id]
+			                                      : std::array<uint64_t, bridge_metrics::OP_SLOTS>{};
+		nlohmann::json per_op = nlohmann::json::object();
+		for (size_t op = 0; op < bridge_metrics::OP_SLOTS; ++op) {
+			if (op == bridge_metrics::OP_ASYNC) {
+				async_calls += current[op];
+				prev_async += previous[op];
+			} else {
+				sync_calls += current[op];
+				prev_sync += previous[op];
+			}
+			if (current[op] != previous[op]) {
+				per_op[OP_LABELS[op]] = rate(current[op], previous[op]);
+			}
+		}
+		if (!per_op.empty()) {
+			breakdown[dispatcher.get_handler(static_cast<uint32_t>(id)).class_name] = std::move(per_op);
+		}
+	}
+
+	syncCallsPerSecond = rate(sync_calls, prev_sync);
+	asyncCallsPerSecond = rate(async_calls, prev_async);
+	bytesInPerSecond = rate(now.bytes_in, m_previous.bytes_in);
+	bytesOutPerSecond = rate(now.bytes_out, m_previous.bytes_out);
+	callsByClass = breakdown.dump();
+
+	// Perzentile über das Fenster: Bucket-Deltas statt Gesamthistogramm
+	bridge_metrics::bucket_counts sync_delta{};
+	bridge_metrics::bucket_counts async_delta{};
+	for (size_t i = 0; i < bridge_metrics::LATENCY_BUCKETS; ++i) {
+		sync_delta[i] = now.sync_buckets[i] - m_previous.sync_buckets[i];
+		async_delta[i] = now.async_buckets[i] - m_previous.async_buckets[i];
+	}
+	syncLatencyP50Us = bridge_metrics::percentile_us(sync_delta, 0.50);
+	syncLatencyP99Us = bridge_metrics::percentile_us(sync_delta, 0.99);
+	asyncLatencyP50Us = bridge_metrics::percentile_us(async_delta, 0.50);
+	asyncLatencyP99Us = bridge_metrics::percentile_us(async_delta, 0.99);
+
+	// Momentaufnahmen
+	auto& pool = webbridge::impl::get_thread_pool();
+	queueDepth = static_cast<int>(pool.pending());
+	workerUtilization = pool.size() == 0
+		? 0.0
+		: static_cast<double>(pool.active()) / static_cast<double>(pool.size());
+	objectCount = static_cast<int>(webbridge::impl::object_registry::total_live());
+
+	m_previous = std::move(now);
+}
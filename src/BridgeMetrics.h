@@ -0,0 +1,91 @@
+#pragma once
+
+#include "webbridge/object.h"
+#include "webbridge/impl/metrics.h"
+
+#include <string>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+/**
+ * Eingebautes Ops-Dashboard-Objekt.
+ *
+ * Stellt die Live-Zähler aus webbridge/impl/metrics.h dem Frontend als
+ * ganz normale webbridge-Properties zur Verfügung - die Klasse wird wie
+ * MyObject/TestObject über register_type registriert und vom Frontend
+ * per Factory erzeugt. Ein Sampler-Thread liest die relaxed Atomics im
+ * eingestellten Intervall aus, bildet Raten und Fenster-Perzentile und
+ * setzt die Properties; die Property-Notifications laufen über den
+ * normalen Coalescer zum Frontend.
+ *
+ * Solange das Frontend kein BridgeMetrics-Objekt erzeugt, existiert
+ * weder Thread noch Overhead - nur die Zähler selbst (relaxed
+ * fetch_add) laufen immer mit.
+ */
+class BridgeMetrics : public webbridge::object
+{
+public:
+	// Raten über das letzte Sample-Fenster
+	property<double> syncCallsPerSecond{ 0.0 };
+	property<double> asyncCallsPerSecond{ 0.0 };
+	property<double> bytesInPerSecond{ 0.0 };
+	property<double> bytesOutPerSecond{ 0.0 };
+
+	// Latenz-Perzentile des letzten Fensters in µs (aus Log2-Buckets
+	// geschätzt, daher auf Zweierpotenzen gerundet)
+	property<double> syncLatencyP50Us{ 0.0 };
+	property<double> syncLatencyP99Us{ 0.0 };
+	property<double> asyncLatencyP50Us{ 0.0 };
+	property<double> asyncLatencyP99Us{ 0.0 };
+
+	// Momentaufnahmen zum Sample-Zeitpunkt
+	property<int> queueDepth{ 0 };
+	property<double> workerUtilization{ 0.0 };	// 0..1, aktive Worker / Pool-Größe
+	property<int> objectCount{ 0 };
+
+	// Aufschlüsselung pro Klasse und Operation als JSON-String, z.B.
+	// {"MyObject": {"call": 120.0, "prop": 4.0}} - Werte sind calls/sec
+	// über das letzte Fenster, Nullzeilen werden weggelassen
+	property<std::string> callsByClass{ "{}" };
+
+public:
+	BridgeMetrics();
+	virtual ~BridgeMetrics();
+
+	// Sample-Intervall in ms (Default 1000, Minimum 100)
+	void setSampleInterval(int ms);
+
+private:
+	void sampler_loop();
+	void take_sample();
+
+	// Zählerstände des letzten Samples (nur vom Sampler-Thread berührt)
+	struct counter_sample {
+		std::vector<std::array<uint64_t, webbridge::impl::bridge_metrics::OP_SLOTS>> calls_by_class;
+		webbridge::impl::bridge_metrics::bucket_counts sync_buckets{};
+		webbridge::impl::bridge_metrics::bucket_counts async_buckets{};
+		uint64_t bytes_in = 0;
+		uint64_t bytes_out = 0;
+		int64_t taken_us = 0;
+	};
+	counter_sample m_previous;
+
+	std::atomic<int> m_interval_ms{ 1000 };
+	bool m_stop = false;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::thread m_sampler;
+};
+
+// convenience method
+#include "BridgeMetrics_registration.h"
+
+namespace webbridge {
+template<> inline void register_type<BridgeMetrics>(webview::webview* w) {
+	impl::register_BridgeMetrics(w);
+}}
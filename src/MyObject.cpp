@@ -37,6 +37,17 @@ void MyObject::throwError()
 	throw std::runtime_error("Test Exception");
 }
 
+std::string MyObject::make_summary() const
+{
+	static const char* status_names[] = { "Idle", "Running", "Completed", "Error" };
+
+	std::string result = "counter=" + std::to_string(counter());
+	result += ", status=";
+	result += status_names[static_cast<int>(status())];
+	result += ", " + std::to_string(numbers().size()) + " Werte";
+	return result;
+}
+
 std::string MyObject::multiParamTest(
 	int intValue,
 	bool boolValue,
@@ -36,6 +36,17 @@ public:
 	property<std::vector<int>> numbers;
 	property<Status> status{ Status::Idle };
 	property<Pod> pod{ Pod{0,0} };
+
+	// Abgeleiteter UI-Zustand: früher hat das Frontend counter, status
+	// und numbers einzeln abonniert und pro Änderung neu formatiert.
+	// Als computed_property rechnet C++ lazy und höchstens einmal pro
+	// Notification-Flush; JS sieht ein normales read-only Property.
+	// Inputs müssen VOR dem computed_property deklariert sein!
+	computed_property<std::string> summary{
+		[this] { return make_summary(); },
+		counter, status, numbers
+	};
+
 	event<int, bool> aEvent;
 
 	const std::string version;
@@ -66,6 +77,9 @@ public:
 		Status statusValue,
 		const Pod& podValue
 	);
+
+private:
+	std::string make_summary() const;
 };
 
 // convenience method
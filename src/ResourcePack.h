@@ -0,0 +1,175 @@
+#pragma once
+
+// Memory-mapped resource pack: an external archive holding large
+// frontend assets (video tutorials, map tiles) that would otherwise be
+// baked into the executable via cmrc. The pack is mapped read-only once
+// at startup and entries are served zero-copy straight from the mapping
+// - cold bytes live in the OS page cache instead of the .rdata section,
+// and the binary (and link time) stays small.
+//
+// Pack layout (little-endian, built by tools/pack_resources.py):
+//   char     magic[4]   "WBPK"
+//   uint32_t version    1
+//   uint64_t index_len  length of the JSON index in bytes
+//   char     index[]    {"<path>": [offset, size, "<etag>"], ...}
+//   ...file data (offsets relative to the end of the index)...
+//
+// ETags are precomputed at pack build time (same FNV-1a as
+// compute_etag() in ResourceServer.h), so serving a multi-hundred-MB
+// entry never hashes it at runtime.
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <cstring>
+#include <cstdint>
+#include <iostream>
+
+class ResourcePack {
+public:
+	struct entry {
+		const char* data;
+		size_t size;
+		std::string etag;	// quoted, ready for the ETag header
+	};
+
+	ResourcePack() = default;
+	ResourcePack(const ResourcePack&) = delete;
+	ResourcePack& operator=(const ResourcePack&) = delete;
+
+	// Maps the pack file and parses its index. Returns false (and logs)
+	// on any structural problem - the caller falls back to cmrc.
+	bool open(const std::filesystem::path& file) {
+		close();
+
+		file_ = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ,
+			nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file_ == INVALID_HANDLE_VALUE) {
+			std::cerr << "ResourcePack: cannot open " << file.string() << "\n";
+			file_ = nullptr;
+			return false;
+		}
+
+		LARGE_INTEGER file_size{};
+		if (!GetFileSizeEx(file_, &file_size)
+			|| static_cast<uint64_t>(file_size.QuadPart) < HEADER_SIZE) {
+			std::cerr << "ResourcePack: " << file.string() << " is truncated\n";
+			close();
+			return false;
+		}
+		size_ = static_cast<size_t>(file_size.QuadPart);
+
+		mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping_) {
+			std::cerr << "ResourcePack: CreateFileMapping failed for " << file.string() << "\n";
+			close();
+			return false;
+		}
+
+		view_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+		if (!view_) {
+			std::cerr << "ResourcePack: MapViewOfFile failed for " << file.string() << "\n";
+			close();
+			return false;
+		}
+
+		if (!parse_index(file)) {
+			close();
+			return false;
+		}
+		return true;
+	}
+
+	const entry* find(const std::string& path) const {
+		auto it = entries_.find(path);
+		return it != entries_.end() ? &it->second : nullptr;
+	}
+
+	explicit operator bool() const {
+		return view_ != nullptr && !entries_.empty();
+	}
+
+	~ResourcePack() {
+		close();
+	}
+
+private:
+	static constexpr uint64_t HEADER_SIZE = 4 + 4 + 8;	// magic + version + index_len
+
+	bool parse_index(const std::filesystem::path& file) {
+		if (std::memcmp(view_, "WBPK", 4) != 0) {
+			std::cerr << "ResourcePack: " << file.string() << " has no WBPK magic\n";
+			return false;
+		}
+
+		uint32_t version = 0;
+		std::memcpy(&version, view_ + 4, sizeof(version));
+		if (version != 1) {
+			std::cerr << "ResourcePack: unsupported version " << version << "\n";
+			return false;
+		}
+
+		uint64_t index_len = 0;
+		std::memcpy(&index_len, view_ + 8, sizeof(index_len));
+		if (HEADER_SIZE + index_len > size_) {
+			std::cerr << "ResourcePack: index exceeds file size\n";
+			return false;
+		}
+
+		// Entry offsets are relative to the end of the index
+		const uint64_t data_base = HEADER_SIZE + index_len;
+		const uint64_t data_size = size_ - data_base;
+
+		try {
+			auto index = nlohmann::json::parse(
+				view_ + HEADER_SIZE, view_ + HEADER_SIZE + index_len);
+			for (const auto& [path, location] : index.items()) {
+				auto offset = location.at(0).get<uint64_t>();
+				auto length = location.at(1).get<uint64_t>();
+				if (offset > data_size || length > data_size - offset) {
+					std::cerr << "ResourcePack: entry out of bounds: " << path << "\n";
+					return false;
+				}
+				entries_.emplace(path, entry{
+					view_ + data_base + offset,
+					static_cast<size_t>(length),
+					"\"" + location.at(2).get<std::string>() + "\""
+				});
+			}
+		} catch (const std::exception& e) {
+			std::cerr << "ResourcePack: bad index in " << file.string()
+				<< ": " << e.what() << "\n";
+			return false;
+		}
+		return true;
+	}
+
+	void close() {
+		entries_.clear();
+		if (view_) {
+			UnmapViewOfFile(view_);
+			view_ = nullptr;
+		}
+		if (mapping_) {
+			CloseHandle(mapping_);
+			mapping_ = nullptr;
+		}
+		if (file_ && file_ != INVALID_HANDLE_VALUE) {
+			CloseHandle(file_);
+		}
+		file_ = nullptr;
+		size_ = 0;
+	}
+
+	HANDLE file_ = nullptr;
+	HANDLE mapping_ = nullptr;
+	const char* view_ = nullptr;
+	size_t size_ = 0;
+	std::unordered_map<std::string, entry> entries_;
+};
@@ -2,10 +2,17 @@
 
 #include <httplib.h>
 #include <cmrc/cmrc.hpp>
+#include "ResourcePack.h"
+#include "webbridge/impl/blob_store.h"
 #include <string>
 #include <thread>
 #include <atomic>
 #include <map>
+#include <mutex>
+#include <format>
+#include <filesystem>
+#include <fstream>
+#include <memory>
 #include <iostream>
 
 CMRC_DECLARE(frontend);
@@ -25,7 +32,13 @@ inline std::string get_mime_type(const std::string& path) {
 		{".woff", "font/woff"},
 		{".woff2", "font/woff2"},
 		{".ttf", "font/ttf"},
-		{".eot", "application/vnd.ms-fontobject"}
+		{".eot", "application/vnd.ms-fontobject"},
+		{".mp4", "video/mp4"},
+		{".webm", "video/webm"},
+		{".mp3", "audio/mpeg"},
+		{".ogg", "audio/ogg"},
+		{".wav", "audio/wav"},
+		{".wasm", "application/wasm"}
 	};
 	
 	auto dot_pos = path.find_last_of('.');
@@ -39,14 +52,70 @@ inline std::string get_mime_type(const std::string& path) {
 	return "application/octet-stream";
 }
 
-// HTTP Server serving embedded resources from cmrc filesystem
+// Cache headers per resource type: HTML entry points must revalidate on
+// every load (so deploys are picked up), everything else may be reused
+// for a day - the ETag turns stale hits into cheap 304s either way.
+inline std::string get_cache_control(const std::string& path) {
+	if (path.ends_with(".html")) {
+		return "no-cache";
+	}
+	return "public, max-age=86400";
+}
+
+// FNV-1a 64-bit - cheap, stable content hash for ETags
+inline std::string compute_etag(const char* data, size_t size) {
+	uint64_t hash = 14695981039346656037ull;
+	for (size_t i = 0; i < size; ++i) {
+		hash ^= static_cast<unsigned char>(data[i]);
+		hash *= 1099511628211ull;
+	}
+	return "\"" + std::format("{:016x}", hash) + "\"";
+}
+
+// HTTP Server serving frontend resources. Per request the backends are
+// tried in order: dev directory (if set), memory-mapped resource pack
+// (if loaded), embedded cmrc filesystem.
 class ResourceServer {
 public:
 	ResourceServer() : running_(false), port_(0) {}
-	
+
+	// Maps an external resource pack (see ResourcePack.h) holding large
+	// assets that should not be baked into the binary. Configure before
+	// start().
+	bool load_pack(const std::filesystem::path& file) {
+		return pack_.open(file);
+	}
+
+	// Dev hot path: serve straight from the frontend source directory -
+	// edit-refresh cycles skip the embed-and-relink step. Configure
+	// before start().
+	void set_dev_root(std::filesystem::path dir) {
+		dev_root_ = std::move(dir);
+	}
+
 	bool start() {
 		auto fs = cmrc::frontend::get_filesystem();
-		server_.Get("/.*", [fs](const httplib::Request& req, httplib::Response& res) {
+
+		// Out-of-band blob channel: large bridge payloads are parked in
+		// the blob store and fetched here as ArrayBuffers, keeping the
+		// webview bind pipe latency-clean. Registered before the
+		// catch-all so it takes precedence.
+		server_.Get(R"(/__webbridge/blob/(\d+))", [](const httplib::Request& req, httplib::Response& res) {
+			auto id = std::strtoull(req.matches[1].str().c_str(), nullptr, 10);
+			auto blob = webbridge::impl::blob_store::instance().take(id);
+			if (!blob) {
+				res.status = 404;
+				res.set_content("Blob not found or already consumed", "text/plain");
+				return;
+			}
+			res.set_content(
+				reinterpret_cast<const char*>(blob->bytes.data()),
+				blob->bytes.size(),
+				blob->content_type
+			);
+		});
+
+		server_.Get("/.*", [this, fs](const httplib::Request& req, httplib::Response& res) {
 			std::string path = req.path;
 
 			if (path == "/" || path.empty()) {
@@ -56,17 +125,65 @@ public:
 			if (!path.empty() && path[0] == '/') {
 				path = path.substr(1);
 			}
-			
+
 			try {
-				if (fs.exists(path)) {
-					auto file = fs.open(path);
-					std::string content(file.begin(), file.end());
-					
-					res.set_content(content, get_mime_type(path));
-				} else {
+				// Dev hot path first: always the freshest bytes, never
+				// cached
+				if (!dev_root_.empty() && serve_from_dev(path, res)) {
+					return;
+				}
+
+				// External pack next: zero-copy from the mapping
+				if (serve_from_pack(path, req, res)) {
+					return;
+				}
+
+				if (!fs.exists(path)) {
 					res.status = 404;
 					res.set_content("Not Found", "text/plain");
+					return;
+				}
+
+				// Prefer the build-time precompressed variant when the
+				// client accepts gzip (WebView2 always does)
+				std::string serve_path = path;
+				bool gzipped = false;
+				auto accept_encoding = req.get_header_value("Accept-Encoding");
+				if (accept_encoding.find("gzip") != std::string::npos && fs.exists(path + ".gz")) {
+					serve_path = path + ".gz";
+					gzipped = true;
 				}
+
+				auto file = fs.open(serve_path);
+
+				// ETag revalidation: reloads hit 304 instead of
+				// re-downloading the multi-MB bundle
+				const auto& etag = etag_for(serve_path, file.begin(), file.size());
+				res.set_header("Cache-Control", get_cache_control(path));
+				res.set_header("ETag", etag);
+				res.set_header("Vary", "Accept-Encoding");
+				if (req.get_header_value("If-None-Match") == etag) {
+					res.status = 304;
+					return;
+				}
+
+				if (gzipped) {
+					res.set_header("Content-Encoding", "gzip");
+				}
+
+				// Zero-copy: cmrc resources are immutable byte ranges
+				// living for the life of the process, so the provider
+				// streams directly from the embedded data - no
+				// per-request std::string copy.
+				const char* data = file.begin();
+				res.set_content_provider(
+					file.size(),
+					get_mime_type(path),
+					[data](size_t offset, size_t length, httplib::DataSink& sink) {
+						sink.write(data + offset, length);
+						return true;
+					}
+				);
 			} catch (const std::exception& e) {
 				res.status = 500;
 				res.set_content(std::string("Internal Server Error: ") + e.what(), "text/plain");
@@ -79,11 +196,14 @@ public:
 			return false;
 		}
 
+		// Publish our base URL so the bridge can hand out blob tickets
+		webbridge::impl::blob_store::instance().set_base_url(get_url());
+
 		running_ = true;
 		server_thread_ = std::thread([this]() {
 			server_.listen_after_bind();
 		});
-		
+
 		return true;
 	}
 	
@@ -108,8 +228,106 @@ public:
 	}
 	
 private:
+	// Serves a pack entry zero-copy from the mapped view. httplib slices
+	// Range requests against the content provider, so seeking in a video
+	// tutorial never touches bytes outside the requested window - they
+	// stream straight from the OS page cache.
+	bool serve_from_pack(const std::string& path, const httplib::Request& req, httplib::Response& res) {
+		if (!pack_) {
+			return false;
+		}
+		const auto* entry = pack_.find(path);
+		if (!entry) {
+			return false;
+		}
+
+		// ETag was precomputed at pack build time - no runtime hashing
+		// of multi-hundred-MB entries
+		res.set_header("Cache-Control", get_cache_control(path));
+		res.set_header("ETag", entry->etag);
+		res.set_header("Accept-Ranges", "bytes");
+		if (req.get_header_value("If-None-Match") == entry->etag) {
+			res.status = 304;
+			return true;
+		}
+
+		const char* data = entry->data;
+		res.set_content_provider(
+			entry->size,
+			get_mime_type(path),
+			[data](size_t offset, size_t length, httplib::DataSink& sink) {
+				sink.write(data + offset, length);
+				return true;
+			}
+		);
+		return true;
+	}
+
+	// Serves a file from the dev root. Files change between requests, so
+	// nothing is cached and no ETag is kept.
+	bool serve_from_dev(const std::string& path, httplib::Response& res) {
+		// The webview only requests our own URLs, but stay defensive:
+		// no path escaping the dev root
+		if (path.find("..") != std::string::npos) {
+			return false;
+		}
+
+		auto file_path = dev_root_ / path;
+		std::error_code ec;
+		if (!std::filesystem::is_regular_file(file_path, ec)) {
+			return false;
+		}
+		auto size = std::filesystem::file_size(file_path, ec);
+		if (ec) {
+			return false;
+		}
+
+		auto stream = std::make_shared<std::ifstream>(file_path, std::ios::binary);
+		if (!*stream) {
+			return false;
+		}
+
+		res.set_header("Cache-Control", "no-store");
+		res.set_header("Accept-Ranges", "bytes");
+		res.set_content_provider(
+			static_cast<size_t>(size),
+			get_mime_type(path),
+			[stream](size_t offset, size_t length, httplib::DataSink& sink) {
+				char chunk[65536];
+				stream->clear();
+				stream->seekg(static_cast<std::streamoff>(offset));
+				auto want = static_cast<std::streamsize>(std::min(length, sizeof(chunk)));
+				stream->read(chunk, want);
+				auto got = stream->gcount();
+				if (got <= 0) {
+					return false;
+				}
+				// Short writes are fine - the provider is called again
+				// with the advanced offset
+				sink.write(chunk, static_cast<size_t>(got));
+				return true;
+			}
+		);
+		return true;
+	}
+
+	// ETags are content hashes of immutable embedded files - compute
+	// each one once and reuse it for the life of the process.
+	const std::string& etag_for(const std::string& path, const char* data, size_t size) {
+		std::lock_guard lock(etag_mutex_);
+		auto it = etag_cache_.find(path);
+		if (it == etag_cache_.end()) {
+			it = etag_cache_.emplace(path, compute_etag(data, size)).first;
+		}
+		return it->second;
+	}
+
 	httplib::Server server_;
 	std::thread server_thread_;
 	std::atomic<bool> running_;
 	int port_;
+	std::mutex etag_mutex_;
+	std::map<std::string, std::string> etag_cache_;
+	ResourcePack pack_;
+	std::filesystem::path dev_root_;
 };
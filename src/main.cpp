@@ -1,16 +1,15 @@
-#include "MyObject.h"
-#include "TestObject.h"
 #include "ResourceServer.h"
+#include "webbridge_registration_bundle.h"
 #include "webbridge/Object.h"
 #include "webbridge/Error.h"
+#include "webbridge/trace.h"
 #include <webview/webview.h>
 #include <portable-file-dialogs.h>
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <cstdio>
-#include <fstream>
-#include <iostream>
+#include <cstdlib>
 
 int WINAPI WinMain(HINSTANCE /*hInst*/, HINSTANCE /*hPrevInst*/,
 	LPSTR /*lpCmdLine*/, int /*nCmdShow*/)
@@ -18,15 +17,34 @@ int WINAPI WinMain(HINSTANCE /*hInst*/, HINSTANCE /*hPrevInst*/,
 	//AllocConsole();
 	freopen("CONOUT$", "w", stdout);
 	freopen("CONOUT$", "w", stderr);
-	
-	// Open timing log file
-	std::ofstream timing_log("timing_trace.log", std::ios::app);
-	std::streambuf* cout_backup = std::cout.rdbuf();
-	std::cout.rdbuf(timing_log.rdbuf());
+
+	// Span tracing statt cout-Umleitung: ist einkompiliert, kostet
+	// deaktiviert praktisch nichts und wird per Umgebungsvariable
+	// scharf geschaltet. Ergebnis in chrome://tracing laden.
+	const char* trace_path = std::getenv("WEBBRIDGE_TRACE");
+	if (trace_path) {
+		webbridge::trace_start(trace_path);
+	}
 
 	try {
 		// Start HTTP server with embedded resources
 		ResourceServer server;
+
+		// Externe Ressourcen-Backends per Umgebungsvariable: ein
+		// mmap-Pack für große Assets (Range-Streaming statt .rdata)
+		// und der Dev-Modus direkt aus dem frontend/-Quellbaum
+		// (Edit-Refresh ohne Embed-und-Relink). Fallback bleibt immer
+		// das einkompilierte cmrc.
+		if (const char* pack_path = std::getenv("WEBBRIDGE_RESOURCE_PACK")) {
+			if (server.load_pack(pack_path)) {
+				std::cout << "Resource pack loaded: " << pack_path << "\n";
+			}
+		}
+		if (const char* dev_root = std::getenv("WEBBRIDGE_DEV_ROOT")) {
+			server.set_dev_root(dev_root);
+			std::cout << "Dev mode: serving from " << dev_root << "\n";
+		}
+
 		if (!server.start()) {
 			std::cerr << "Failed to start resource server\n";
 			return 1;
@@ -55,17 +73,17 @@ int WINAPI WinMain(HINSTANCE /*hInst*/, HINSTANCE /*hPrevInst*/,
 			std::cout << "Error " << err.code << ": " << err.message << "\n";
 		});
 		
-		// Register type -> needs to be created in js
-		webbridge::register_type<MyObject>(&w);
-		webbridge::register_type<TestObject>(&w);
+		// Register all exposed types -> creatable from js.
+		// One combined config script instead of one eval per class.
+		webbridge::register_all(&w);
 
 		// Navigate FIRST so the frontend (with WebbridgeRuntime) is loaded
 		w.navigate(server.get_url());
 		w.run();
-		
-		// Restore cout and close timing log
-		std::cout.rdbuf(cout_backup);
-		timing_log.close();
+
+		if (trace_path) {
+			webbridge::trace_stop();
+		}
 	} catch (const webview::exception &e) {
 		std::cerr << e.what() << '\n';
 		return 1;
@@ -28,6 +28,8 @@ enum error_code : int {
 	JSON_ACCESS_ERROR		= 4003,  // Missing key or array index
 	INVALID_ARGUMENT		= 4004,  // Invalid argument from JS
 	OBJECT_NOT_FOUND		= 4005,  // Object ID not found in registry
+	CALL_CANCELLED			= 4006,  // Async call cancelled from JS
+	QUEUE_OVERLOADED		= 4007,  // Async call rejected: task queue full
 
 	// =========================================
 	// 5xxx: C++/Server errors (runtime)
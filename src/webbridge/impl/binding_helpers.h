@@ -15,25 +15,150 @@
 #include <type_traits>
 #include <stdexcept>
 #include <typeinfo>
+#include <string_view>
+#include <cstdint>
 #include <nlohmann/json.hpp>
 
 #include "object_registry.h"
 #include "property_impl.h"
+#include "task_impl.h"
 #include "event_impl.h"
 #include "concepts.h"
+#include "wire_protocol.h"
+#include "notification_queue.h"
+#include "event_channel.h"
+#include "serialization_arena.h"
 #include "../object.h"
 #include "../Error.h"
 
 namespace webbridge::impl {
 
+// =============================================================================
+// Compile-Time Member Hashing
+// =============================================================================
+
+/**
+ * FNV-1a 64-bit, constexpr-fähig. Die generierten Handler springen per
+ * switch über member_hash(member) direkt zum richtigen Member, statt
+ * eine if/else-Kette von Stringvergleichen abzulaufen. Der Generator
+ * prüft beim Erzeugen, dass die Hashes innerhalb einer Klasse
+ * kollisionsfrei sind - ein unbekannter Member fällt als billiger
+ * Table-Miss aus dem switch.
+ */
+constexpr uint64_t member_hash(std::string_view name) {
+	uint64_t hash = 14695981039346656037ull;
+	for (char c : name) {
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+// =============================================================================
+// TypedArray Marshalling
+// =============================================================================
+
+/**
+ * Zusammenhängende Zahlencontainer (vector<int>, vector<double>, ...)
+ * reisen nicht als JSON-Zahlenliste, sondern als
+ * {"$typed": {"t": "i32", "b": "<base64>"}}-Envelope: die Rohbytes
+ * werden am Stück kopiert (beide Seiten little-endian) und kommen in JS
+ * als Int32Array/Float64Array-View an - kein Element-für-Element-Parsen
+ * und kein verdoppelter Speicher bei 100k-Sample-Waveforms.
+ */
+template<typename T>
+struct typed_array_tag;
+
+template<> struct typed_array_tag<int8_t>   { static constexpr const char* value = "i8"; };
+template<> struct typed_array_tag<uint8_t>  { static constexpr const char* value = "u8"; };
+template<> struct typed_array_tag<int16_t>  { static constexpr const char* value = "i16"; };
+template<> struct typed_array_tag<uint16_t> { static constexpr const char* value = "u16"; };
+template<> struct typed_array_tag<int32_t>  { static constexpr const char* value = "i32"; };
+template<> struct typed_array_tag<uint32_t> { static constexpr const char* value = "u32"; };
+template<> struct typed_array_tag<float>    { static constexpr const char* value = "f32"; };
+template<> struct typed_array_tag<double>   { static constexpr const char* value = "f64"; };
+
+/// Element types with a JS TypedArray counterpart. char (std::string)
+/// has deliberately no tag, so strings never match.
+template<typename T>
+concept typed_array_element = requires { typed_array_tag<T>::value; };
+
+/// Contiguous container of typed-array elements (vector, array).
+template<typename C>
+concept typed_array_container =
+	typed_array_element<typename C::value_type> &&
+	requires(const C& c) {
+		{ c.data() } -> std::convertible_to<const typename C::value_type*>;
+		{ c.size() } -> std::convertible_to<size_t>;
+	};
+
+template<typename C> requires typed_array_container<C>
+nlohmann::json make_typed_envelope(const C& values) {
+	using element_type = typename C::value_type;
+	return nlohmann::json{{"$typed", {
+		{"t", typed_array_tag<element_type>::value},
+		{"b", base64_encode(
+			reinterpret_cast<const uint8_t*>(values.data()),
+			values.size() * sizeof(element_type))}
+	}}};
+}
+
+/**
+ * Serialisiert einen Wert für die Leitung: TypedArray-Envelope für
+ * Zahlencontainer, sonst der normale serialize_for_wire-Pfad.
+ */
+template<typename T>
+std::string serialize_value(const T& value) {
+	if constexpr (typed_array_container<T>) {
+		return make_typed_envelope(value).dump();
+	} else {
+		return serialize_for_wire(nlohmann::json(value));
+	}
+}
+
+/**
+ * Wie serialize_value, aber als eingebetteter JSON-Wert - für Werte,
+ * die Teil eines größeren Dokuments sind (Snapshot, Creation-Descriptor).
+ */
+template<typename T>
+nlohmann::json to_wire_json(const T& value) {
+	if constexpr (typed_array_container<T>) {
+		return make_typed_envelope(value);
+	} else {
+		return nlohmann::json(value);
+	}
+}
+
 // =============================================================================
 // Central Error Handling
 // =============================================================================
 
+/**
+ * Maps the in-flight exception to tuple<status_code, json_string>.
+ * Must only be called from inside a catch block.
+ */
+inline std::tuple<int, std::string> map_current_exception() {
+	try {
+		throw;
+	}
+	catch (const nlohmann::json::exception& ex) {
+		auto err = from_json_exception(ex);
+		return {err.code, err.dump()};
+	}
+	catch (const std::exception& ex) {
+		auto err = from_cpp_exception(ex, RUNTIME_ERROR);
+		return {err.code, err.dump()};
+	}
+	catch (...) {
+		auto err = unknown_error();
+		return {err.code, err.dump()};
+	}
+}
+
 /**
  * Executes a callable, serializes result to JSON, catches all exceptions.
  * Returns tuple<status_code, json_string>.
- * 
+ *
  * Success: {0, <value>}        - Direct value for clean JS API
  * Error:   {code, {"error":...}} - Structured error object
  */
@@ -41,26 +166,50 @@ template<typename Callable, typename... Args>
 std::tuple<int, std::string> invoke_and_serialize(Callable&& func, Args&&... args) {
 	try {
 		using result_type = std::invoke_result_t<Callable, Args...>;
-		
+
 		if constexpr (std::is_void_v<result_type>) {
 			std::invoke(std::forward<Callable>(func), std::forward<Args>(args)...);
 			return {0, "null"};
 		} else {
 			auto result = std::invoke(std::forward<Callable>(func), std::forward<Args>(args)...);
-			return {0, nlohmann::json(result).dump()};
+			return {0, serialize_value(result)};
 		}
 	}
-	catch (const nlohmann::json::exception& ex) {
-		auto err = from_json_exception(ex);
-		return {err.code, err.dump()};
+	catch (...) {
+		return map_current_exception();
 	}
-	catch (const std::exception& ex) {
-		auto err = from_cpp_exception(ex, RUNTIME_ERROR);
-		return {err.code, err.dump()};
+}
+
+// =============================================================================
+// Coroutine Task Resolution
+// =============================================================================
+
+/**
+ * Startet eine Coroutine-Methode (webbridge::task<T>) und resolved das
+ * JS-Promise erst bei deren Abschluss. func läuft auf dem Pool-Worker
+ * nur bis zum ersten co_await und gibt ihn dann frei - hunderte
+ * parallele I/O-Calls belegen so eine Handvoll Threads. obj wird in der
+ * Continuation festgehalten, damit das Zielobjekt offene
+ * Suspendierungen überlebt (auch wenn JS es zwischenzeitlich zerstört).
+ */
+template<typename TObj, typename Callable>
+void invoke_task_and_resolve(
+	webview::webview& w_ref,
+	const std::string& req_id,
+	std::shared_ptr<TObj> obj,
+	Callable&& func)
+{
+	try {
+		auto t = std::forward<Callable>(func)();
+		t.on_completed([&w_ref, req_id, obj = std::move(obj), t]() mutable {
+			auto [status, json] = invoke_and_serialize([&]() { return t.result(); });
+			w_ref.resolve(req_id, status, json);
+		});
 	}
 	catch (...) {
-		auto err = unknown_error();
-		return {err.code, err.dump()};
+		// Argument conversion failed before the coroutine even started
+		auto [status, json] = map_current_exception();
+		w_ref.resolve(req_id, status, json);
 	}
 }
 
@@ -69,10 +218,10 @@ std::tuple<int, std::string> invoke_and_serialize(Callable&& func, Args&&... arg
 // =============================================================================
 
 template<typename TObj>
-std::shared_ptr<TObj> get_object_or_throw(object_registry& registry, const std::string& object_id) {
+std::shared_ptr<TObj> get_object_or_throw(object_registry& registry, std::string_view object_id) {
 	auto obj = registry.get<TObj>(object_id);
 	if (!obj) {
-		throw std::runtime_error("Object not found: " + object_id);
+		throw std::runtime_error("Object not found: " + std::string(object_id));
 	}
 	return obj;
 }
@@ -81,6 +230,43 @@ std::shared_ptr<TObj> get_object_or_throw(object_registry& registry, const std::
 // Property Subscription
 // =============================================================================
 
+/**
+ * Geteilter Zustand eines Delta-Properties: der zuletzt versendete
+ * JSON-Wert als Diff-Basis. Der Mutex serialisiert parallele set()-
+ * Callbacks, damit die Patch-Folge auf der JS-Seite konsistent bleibt.
+ */
+struct property_delta_state {
+	std::mutex mutex;
+	bool has_base = false;
+	nlohmann::json base;
+};
+
+/**
+ * Baut die Delta-Payload: RFC-6902-Patch (nlohmann json::diff) gegen
+ * den zuletzt versendeten Wert, verpackt als {"$patch": [...]}. Ein
+ * Append an eine Sequenz wird so zu einer einzelnen add-Op, eine
+ * Feldänderung in einem Pod zu einer replace-Op auf dem Key. Fällt auf
+ * den vollen Wert zurück, wenn noch keine Basis existiert oder der
+ * Patch nicht kleiner ist (z.B. komplett ersetzter Container).
+ */
+inline std::string make_delta_payload(property_delta_state& state, nlohmann::json now) {
+	std::lock_guard lock(state.mutex);
+	std::string payload;
+	if (state.has_base) {
+		auto patch = nlohmann::json::diff(state.base, now);
+		payload = nlohmann::json{{"$patch", std::move(patch)}}.dump();
+		auto full = now.dump();
+		if (full.size() <= payload.size()) {
+			payload = std::move(full);
+		}
+	} else {
+		payload = now.dump();
+	}
+	state.base = std::move(now);
+	state.has_base = true;
+	return payload;
+}
+
 template<typename T>
 void subscribe_property(
 	webview::webview& w_ref,
@@ -88,16 +274,100 @@ void subscribe_property(
 	const std::string& prop_name,
 	property<T>& prop)
 {
-	prop.set_on_changed([&w_ref, object_id, prop_name](const T& val) {
-		w_ref.dispatch([&w_ref, object_id, prop_name, val]() {
-			w_ref.eval(std::format(
-				"window.__webbridge_notify('{}', '{}', {})",
-				object_id, prop_name, nlohmann::json(val).dump()
-			));
+	if (prop.delta_updates_enabled()) {
+		// Delta-Modus: es reist nur der strukturelle Diff gegen den
+		// zuletzt versendeten Stand; PropertyStore._notify patcht den
+		// currentValue in place. Update-Kosten skalieren mit der
+		// Änderung, nicht mit der Containergröße. Bewusst immer der
+		// reine JSON-Pfad - TypedArray-/CBOR-Envelopes sind als
+		// Patch-Basis nicht brauchbar.
+		auto state = std::make_shared<property_delta_state>();
+		prop.set_on_changed([&w_ref, object_id, prop_name, state](const T& val) {
+			notification_coalescer::instance().enqueue_delta(
+				w_ref, object_id, prop_name,
+				make_delta_payload(*state, nlohmann::json(val))
+			);
 		});
+		return;
+	}
+
+	prop.set_on_changed([&w_ref, object_id, prop_name](const T& val) {
+		// Serialize on the writing thread, then hand off to the
+		// coalescer - one batched eval per pump cycle instead of one
+		// dispatch + eval per set(). Numeric containers take the
+		// TypedArray envelope instead of the JSON number-list path.
+		notification_coalescer::instance().enqueue(
+			w_ref, object_id, prop_name,
+			serialize_value(val)
+		);
 	});
 }
 
+/**
+ * Computed-Variante: Input-Invalidierungen werten NICHT sofort aus,
+ * sondern registrieren (einmal pro Burst) eine deferred Auswertung beim
+ * Coalescer. Zum Flush-Zeitpunkt wird höchstens einmal gerechnet, und
+ * nur ein tatsächlich geändertes Ergebnis geht als Notification raus -
+ * N Upstream-Änderungen kollabieren zu maximal einer Downstream-
+ * Notification.
+ */
+template<typename T>
+void subscribe_property(
+	webview::webview& w_ref,
+	const std::string& object_id,
+	const std::string& prop_name,
+	computed_property<T>& prop)
+{
+	prop.set_on_changed([&w_ref, object_id, prop_name](const T& val) {
+		notification_coalescer::instance().enqueue(
+			w_ref, object_id, prop_name,
+			serialize_value(val)
+		);
+	});
+	prop.set_notify_scheduler([&w_ref, &prop]() {
+		notification_coalescer::instance().enqueue_eval(
+			w_ref, [&prop]() { prop.evaluate_and_notify(); }
+		);
+	});
+}
+
+/**
+ * Property-Read für die generierten Handler (op "prop"): Delta-
+ * Properties bleiben auf dem reinen JSON-Pfad, damit die JS-Seite
+ * einen patchbaren Basiswert bekommt statt einer TypedArray-View.
+ */
+template<typename T>
+std::string serialize_property(const property<T>& prop) {
+	if (prop.delta_updates_enabled()) {
+		return nlohmann::json(prop.get()).dump();
+	}
+	return serialize_value(prop.get());
+}
+
+/**
+ * Wie serialize_property, aber als eingebetteter JSON-Wert - für
+ * Snapshot und Creation-Descriptor.
+ */
+template<typename T>
+nlohmann::json property_wire_json(const property<T>& prop) {
+	if (prop.delta_updates_enabled()) {
+		return nlohmann::json(prop.get());
+	}
+	return to_wire_json(prop.get());
+}
+
+// Computed-Varianten: get() rechnet nur neu, wenn sich seit der letzten
+// Auswertung ein Input geändert hat (lazy), sonst kommt der Cache.
+template<typename T>
+std::string serialize_property(const computed_property<T>& prop) {
+	return serialize_value(prop.get());
+}
+
+template<typename T>
+nlohmann::json property_wire_json(const computed_property<T>& prop) {
+	return to_wire_json(prop.get());
+}
+
 // =============================================================================
 // Event Subscription
 // =============================================================================
@@ -110,17 +380,27 @@ void subscribe_event(
 	event<Args...>& evt)
 {
 	evt.set_forwarder([&w_ref, object_id, event_name](Args... args) {
-		w_ref.dispatch([&w_ref, object_id, event_name, args...]() {
-			std::string args_str;
-			((args_str += nlohmann::json(args).dump() + ", "), ...);
-			if (!args_str.empty()) {
-				args_str.resize(args_str.size() - 2);
+		// Serialize on the emitting thread, then push into the bounded
+		// ring buffer - the drainer delivers events to JS in batches
+		// instead of one dispatch per emission. The args array is built
+		// directly in an arena buffer (no intermediate nlohmann array +
+		// dump); only the owned copy handed to the ring allocates.
+		arena_buffer buffer;
+		auto& out = buffer.str();
+		out += '[';
+		bool first = true;
+		auto append = [&](const auto& value) {
+			if (!first) {
+				out += ',';
 			}
-			w_ref.eval(std::format(
-				"window.__webbridge_emit('{}', '{}', {})",
-				object_id, event_name, args_str
-			));
-		});
+			first = false;
+			out += serialize_value(value);
+		};
+		(append(args), ...);
+		out += ']';
+		event_channel::instance().publish(
+			w_ref, object_id, event_name, out
+		);
 	});
 }
 
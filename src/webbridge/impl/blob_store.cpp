@@ -0,0 +1,73 @@
+#include "blob_store.h"
+
+#include <format>
+
+namespace webbridge::impl {
+
+blob_store& blob_store::instance() {
+	static blob_store inst;
+	return inst;
+}
+
+void blob_store::set_base_url(std::string url) {
+	std::lock_guard lock(m_mutex);
+	m_base_url = std::move(url);
+}
+
+bool blob_store::available() const {
+	std::lock_guard lock(m_mutex);
+	return !m_base_url.empty();
+}
+
+std::string blob_store::park(std::vector<uint8_t> bytes, std::string content_type) {
+	std::lock_guard lock(m_mutex);
+
+	evict_expired_locked();
+
+	auto id = m_next_id++;
+	auto data = std::make_shared<blob>(blob{std::move(bytes), std::move(content_type)});
+	m_blobs[id] = {std::move(data), std::chrono::steady_clock::now()};
+
+	return std::format("{}/__webbridge/blob/{}", m_base_url, id);
+}
+
+std::shared_ptr<blob_store::blob> blob_store::take(uint64_t id) {
+	std::lock_guard lock(m_mutex);
+
+	auto it = m_blobs.find(id);
+	if (it == m_blobs.end()) {
+		return nullptr;
+	}
+	auto data = std::move(it->second.data);
+	m_blobs.erase(it);
+	return data;
+}
+
+std::vector<uint8_t> blob_store::acquire_buffer() {
+	std::lock_guard lock(m_mutex);
+	if (m_buffer_pool.empty()) {
+		return {};
+	}
+	auto buffer = std::move(m_buffer_pool.back());
+	m_buffer_pool.pop_back();
+	buffer.clear();
+	return buffer;
+}
+
+void blob_store::evict_expired_locked() {
+	auto now = std::chrono::steady_clock::now();
+	for (auto it = m_blobs.begin(); it != m_blobs.end();) {
+		if (now - it->second.parked_at > MAX_AGE) {
+			// Recycle the capacity of the abandoned blob
+			if (it->second.data.use_count() == 1
+				&& m_buffer_pool.size() < MAX_POOLED_BUFFERS) {
+				m_buffer_pool.push_back(std::move(it->second.data->bytes));
+			}
+			it = m_blobs.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+} // namespace webbridge::impl
@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+ * WebBridge Blob Store
+ *
+ * Side channel for bulk data. Pushing a megabyte-scale value through
+ * the webview bind pipe means JSON/CBOR text in a single string - it
+ * stalls the bridge for every call queued behind it. Instead, large
+ * results are parked here and the JS runtime receives only a ticket:
+ *
+ *   {"$blob": "http://127.0.0.1:<port>/__webbridge/blob/<id>"}
+ *
+ * The runtime fetches the bytes as an ArrayBuffer over the existing
+ * ResourceServer - a path the browser streams natively - and decodes
+ * them off the bind channel. Blobs are one-shot: the fetch consumes the
+ * entry. Unfetched entries are evicted by age so an abandoned ticket
+ * cannot pin memory.
+ *
+ * Freed byte buffers are recycled through a small pool to avoid
+ * re-allocating megabyte vectors on every large result.
+ */
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <chrono>
+#include <cstdint>
+
+namespace webbridge::impl {
+
+class blob_store {
+public:
+	struct blob {
+		std::vector<uint8_t> bytes;
+		std::string content_type;
+	};
+
+	static blob_store& instance();
+
+	/**
+	 * Publishes the HTTP base URL ("http://127.0.0.1:<port>").
+	 * Called by the ResourceServer once it is bound; until then the
+	 * store is unavailable and values stay on the bind channel.
+	 */
+	void set_base_url(std::string url);
+	bool available() const;
+
+	/**
+	 * Parks bytes and returns the full fetch URL for the JS side.
+	 */
+	std::string park(std::vector<uint8_t> bytes, std::string content_type);
+
+	/**
+	 * Fetches and removes a parked blob. Returns nullptr for unknown
+	 * (or already consumed) tickets.
+	 */
+	std::shared_ptr<blob> take(uint64_t id);
+
+	/**
+	 * Returns a buffer from the recycle pool (empty, capacity kept).
+	 */
+	std::vector<uint8_t> acquire_buffer();
+
+private:
+	blob_store() = default;
+
+	void evict_expired_locked();
+
+	struct entry {
+		std::shared_ptr<blob> data;
+		std::chrono::steady_clock::time_point parked_at;
+	};
+
+	// Unfetched blobs older than this are dropped on the next park()
+	static constexpr std::chrono::seconds MAX_AGE{30};
+	static constexpr size_t MAX_POOLED_BUFFERS = 8;
+
+	mutable std::mutex m_mutex;
+	std::string m_base_url;
+	std::map<uint64_t, entry> m_blobs;
+	std::vector<std::vector<uint8_t>> m_buffer_pool;
+	uint64_t m_next_id = 1;
+};
+
+} // namespace webbridge::impl
@@ -0,0 +1,27 @@
+#include "bridge_context.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace webbridge::impl {
+
+namespace {
+
+// Kontexte leben bis Prozessende; unique_ptr hält die Adressen stabil,
+// auch wenn die Map rehasht.
+std::mutex g_context_mutex;
+std::unordered_map<webview::webview*, std::unique_ptr<bridge_context>> g_contexts;
+
+} // namespace
+
+bridge_context& bridge_context::for_webview(webview::webview* w) {
+	std::lock_guard lock(g_context_mutex);
+	auto& slot = g_contexts[w];
+	if (!slot) {
+		slot.reset(new bridge_context(w));
+	}
+	return *slot;
+}
+
+} // namespace webbridge::impl
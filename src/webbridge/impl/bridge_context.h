@@ -0,0 +1,65 @@
+#pragma once
+
+/**
+ * WebBridge Bridge Context
+ *
+ * Ein Kontext pro WebView-Fenster. Früher teilten sich alle Fenster die
+ * prozessweite object_registry::instance() plus ein statisches
+ * initialized_webviews-Set - bei 4-6 Fenstern pro Station multiplizierte
+ * jedes zusätzliche Fenster die Konkurrenz auf denselben Shard-Mutexen.
+ *
+ * Jetzt besitzt jedes Fenster seinen eigenen Registry-Shard: Objekte
+ * verschiedener Fenster berühren sich bei register/remove/get überhaupt
+ * nicht mehr. Die Handler-Tabelle (dispatcher_registry) bleibt bewusst
+ * prozessweit - sie ist nach dem Startup read-only und verursacht keine
+ * Konkurrenz; ebenso der Thread-Pool, dessen Kerne eine prozessweite
+ * Ressource sind.
+ *
+ * Objekte lassen sich über share_from() EXPLIZIT zwischen Kontexten
+ * teilen: das Zielfenster bekommt ein eigenes Handle auf dasselbe
+ * C++-Objekt, beide Registries halten eine eigene shared_ptr-Referenz
+ * und remove() wirkt nur lokal.
+ */
+
+#include "object_registry.h"
+
+#include <webview/webview.h>
+#include <string>
+#include <string_view>
+
+namespace webbridge::impl {
+
+class bridge_context {
+public:
+	// Kontext für w; wird beim ersten Zugriff angelegt. Adressen sind
+	// stabil - Bindings dürfen Referenzen auf die Registry capturen.
+	static bridge_context& for_webview(webview::webview* w);
+
+	object_registry& registry() { return m_registry; }
+	webview::webview* view() const { return m_view; }
+
+	// init_webview tracking (replaces the static initialized_webviews set)
+	bool initialized() const { return m_initialized; }
+	void mark_initialized() { m_initialized = true; }
+
+	/**
+	 * Teilt ein im Quell-Kontext registriertes Objekt in diesen Kontext.
+	 * Liefert das NEUE Handle für die JS-Seite dieses Fensters (leerer
+	 * String, wenn object_id im Quell-Kontext nicht existiert).
+	 */
+	std::string share_from(bridge_context& source, std::string_view object_id) {
+		return m_registry.adopt(source.m_registry, object_id);
+	}
+
+	bridge_context(const bridge_context&) = delete;
+	bridge_context& operator=(const bridge_context&) = delete;
+
+private:
+	explicit bridge_context(webview::webview* w) : m_view(w) {}
+
+	webview::webview* m_view;
+	object_registry m_registry;
+	bool m_initialized = false;
+};
+
+} // namespace webbridge::impl
@@ -0,0 +1,45 @@
+#include "cancellation.h"
+
+namespace webbridge::impl {
+
+cancellation_registry& cancellation_registry::instance() {
+	static cancellation_registry inst;
+	return inst;
+}
+
+cancellation_token cancellation_registry::register_call(uint64_t call_id) {
+	auto flag = std::make_shared<std::atomic<bool>>(false);
+	{
+		std::lock_guard lock(m_mutex);
+		m_calls[call_id] = flag;
+	}
+	return cancellation_token(std::move(flag));
+}
+
+bool cancellation_registry::cancel(uint64_t call_id) {
+	std::lock_guard lock(m_mutex);
+	auto it = m_calls.find(call_id);
+	if (it == m_calls.end()) {
+		return false;
+	}
+	it->second->store(true, std::memory_order_release);
+	return true;
+}
+
+void cancellation_registry::complete(uint64_t call_id) {
+	std::lock_guard lock(m_mutex);
+	m_calls.erase(call_id);
+}
+
+// Token of the async call currently executing on this worker thread
+static thread_local cancellation_token t_current_token;
+
+void set_current_cancellation_token(cancellation_token token) {
+	t_current_token = std::move(token);
+}
+
+cancellation_token current_cancellation_token() {
+	return t_current_token;
+}
+
+} // namespace webbridge::impl
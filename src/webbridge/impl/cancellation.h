@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * WebBridge Async Call Cancellation
+ *
+ * Every __webbridge_async call carries a JS-generated call id. The JS
+ * side can abort an in-flight call via window.__webbridge_cancel(id):
+ *
+ * - If the task is still queued, it is skipped entirely and the Promise
+ *   rejects with CALL_CANCELLED - the worker is never occupied.
+ * - If the task is already running, the token flips to cancelled and
+ *   the method can poll webbridge::current_cancellation_token() to bail
+ *   out early instead of pinning the worker.
+ */
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <cstdint>
+
+namespace webbridge::impl {
+
+class cancellation_token {
+public:
+	cancellation_token() = default;
+
+	explicit cancellation_token(std::shared_ptr<std::atomic<bool>> flag)
+		: m_flag(std::move(flag)) {}
+
+	/// True once the JS side has cancelled the call.
+	[[nodiscard]] bool cancelled() const {
+		return m_flag && m_flag->load(std::memory_order_acquire);
+	}
+
+	/// True if this token is attached to a call.
+	explicit operator bool() const {
+		return m_flag != nullptr;
+	}
+
+private:
+	friend class cancellation_registry;
+	std::shared_ptr<std::atomic<bool>> m_flag;
+};
+
+// =============================================================================
+// Call Registry (call id -> cancellation flag)
+// =============================================================================
+
+class cancellation_registry {
+public:
+	static cancellation_registry& instance();
+
+	/// Registers a new in-flight call. Returns its token.
+	cancellation_token register_call(uint64_t call_id);
+
+	/// Cancels a call. Returns false if the call already finished.
+	bool cancel(uint64_t call_id);
+
+	/// Removes a finished call from the registry.
+	void complete(uint64_t call_id);
+
+private:
+	cancellation_registry() = default;
+
+	std::mutex m_mutex;
+	std::unordered_map<uint64_t, std::shared_ptr<std::atomic<bool>>> m_calls;
+};
+
+// =============================================================================
+// Current Token (thread-local, for cooperative cancellation in methods)
+// =============================================================================
+
+void set_current_cancellation_token(cancellation_token token);
+cancellation_token current_cancellation_token();
+
+} // namespace webbridge::impl
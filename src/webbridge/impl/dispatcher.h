@@ -10,11 +10,15 @@
  */
 
 #include <string>
+#include <string_view>
 #include <functional>
+#include <tuple>
+#include <map>
 #include <unordered_map>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include "webview/webview.h"
+#include "thread_pool.h"
 
 namespace webbridge::impl {
 
@@ -25,33 +29,42 @@ class object_registry;
 // Handler Types
 // =============================================================================
 
-// Sync handler: Called on main thread, returns result immediately
-// Parameters: webview&, registry&, req_id, object_id, operation, member, args_json
-using sync_handler_t = std::function<void(
-    webview::webview&,
+// Sync handler: Called on main thread, returns {status, wire_json}.
+// The CALLER resolves the Promise - handlers never talk to the webview
+// directly, which is what lets the batch dispatcher collect N results
+// into a single response instead of N bridge crossings.
+// object_id/operation/member are views into the parsed request DOM (or
+// the interned member tables) - valid for the duration of the call, so
+// the dispatch phase never copies them.
+using sync_handler_t = std::function<std::tuple<int, std::string>(
     object_registry&,
-    const std::string& req_id,
-    const std::string& object_id,
-    const std::string& operation,
-    const std::string& member,
+    std::string_view object_id,
+    std::string_view operation,
+    std::string_view member,
     const nlohmann::json& args
 )>;
 
 // Async handler: Called on background thread
 // Parameters: webview&, registry&, req_id, object_id, method, args_json
+// object_id/method views point into the args copy captured by the
+// submitted task (or the interned tables), not into the original request.
 using async_handler_t = std::function<void(
     webview::webview&,
     object_registry&,
     const std::string& req_id,
-    const std::string& object_id,
-    const std::string& method,
+    std::string_view object_id,
+    std::string_view method,
     const nlohmann::json& args
 )>;
 
 // Create handler: Creates new instance
 // Parameters: webview&, registry&, args_json
-// Returns: object_id
-using create_handler_t = std::function<std::string(
+// Returns: creation descriptor
+//   {"id": objectId, "constants": {...}, "props": {...}}
+// carrying the instance constants and initial property values, so
+// creating an object is exactly one bridge round-trip regardless of
+// how many members the class declares.
+using create_handler_t = std::function<nlohmann::json(
     webview::webview&,
     object_registry&,
     const nlohmann::json& args
@@ -61,11 +74,75 @@ using create_handler_t = std::function<std::string(
 // Class Handler - Contains all handlers for a single C++ class
 // =============================================================================
 
+// =============================================================================
+// Interned Member Tables
+// =============================================================================
+
+// Member names in registration order. The JS runtime resolves names to
+// indices once at __webbridge_createClass time and sends only small
+// integers per call; the C++ side maps them back via these tables - no
+// per-call string allocation, hashing or comparison on the wire.
+struct member_tables {
+    std::vector<std::string> properties;        // op 0: "prop"
+    std::vector<std::string> constants;         // op 1: "const" (instance constants)
+    std::vector<std::string> sync_methods;      // op 2: "call"
+    std::vector<std::string> async_methods;
+
+    const std::string& member_name(int op_code, size_t index) const {
+        const auto& table = [&]() -> const std::vector<std::string>& {
+            switch (op_code) {
+                case 0: return properties;
+                case 1: return constants;
+                case 2: return sync_methods;
+                default: throw std::runtime_error("Unknown op code: " + std::to_string(op_code));
+            }
+        }();
+        if (index >= table.size()) {
+            throw std::runtime_error("Member index out of range: " + std::to_string(index));
+        }
+        return table[index];
+    }
+
+    const std::string& async_method_name(size_t index) const {
+        if (index >= async_methods.size()) {
+            throw std::runtime_error("Async method index out of range: " + std::to_string(index));
+        }
+        return async_methods[index];
+    }
+};
+
+// Maps a numeric op code from the JS runtime to the operation string
+// the generated handlers understand. Op 3 ("snapshot") returns all
+// property values of an object in one response and takes no member.
+inline const std::string& op_name(int op_code) {
+    static const std::string names[] = {"prop", "const", "call", "snapshot"};
+    if (op_code < 0 || op_code > 3) {
+        throw std::runtime_error("Unknown op code: " + std::to_string(op_code));
+    }
+    return names[op_code];
+}
+
 struct class_handler {
     std::string class_name;
     sync_handler_t sync;
     async_handler_t async;
     create_handler_t create;
+
+    // Priority lane per async method ([[async(high)]] / [[async(background)]]).
+    // Methods not listed here run with normal priority. std::less<> so
+    // lookups work with string_views without materializing a string.
+    std::map<std::string, task_priority, std::less<>> async_priorities;
+
+    // Interned member names for numeric-ID dispatch
+    member_tables members;
+
+    // Dense id assigned at registration; sent by JS instead of the name
+    uint32_t class_id = 0;
+
+    task_priority priority_for(std::string_view method) const {
+        auto it = async_priorities.find(method);
+        return it != async_priorities.end() ? it->second : task_priority::normal;
+    }
 };
 
 // =============================================================================
@@ -79,9 +156,19 @@ public:
         return inst;
     }
 
-    // Register handlers for a class
+    // Register handlers for a class and assign its dense numeric id
     void register_class(const std::string& class_name, class_handler handler) {
-        handlers_[class_name] = std::move(handler);
+        auto it = handlers_.find(class_name);
+        if (it != handlers_.end()) {
+            // Re-registration keeps the already-published id
+            handler.class_id = it->second.class_id;
+            it->second = std::move(handler);
+            handlers_by_id_[it->second.class_id] = &it->second;
+            return;
+        }
+        handler.class_id = static_cast<uint32_t>(handlers_by_id_.size());
+        auto [inserted, _] = handlers_.emplace(class_name, std::move(handler));
+        handlers_by_id_.push_back(&inserted->second);
     }
 
     // Check if a class is registered
@@ -98,6 +185,20 @@ public:
         return it->second;
     }
 
+    // Numeric-ID fast path: a flat array index instead of a hash lookup
+    const class_handler& get_handler(uint32_t class_id) const {
+        if (class_id >= handlers_by_id_.size()) {
+            throw std::runtime_error("Unknown class id: " + std::to_string(class_id));
+        }
+        return *handlers_by_id_[class_id];
+    }
+
+    // Number of registered classes; dense ids run from 0 to count-1
+    // (used by the metrics sampler to walk the per-class counters)
+    size_t class_count() const {
+        return handlers_by_id_.size();
+    }
+
     // Get all registered class names (for debugging)
     std::vector<std::string> get_class_names() const {
         std::vector<std::string> names;
@@ -111,6 +212,8 @@ public:
 private:
     dispatcher_registry() = default;
     std::unordered_map<std::string, class_handler> handlers_;
+    // unordered_map node addresses are stable, so raw pointers are safe
+    std::vector<class_handler*> handlers_by_id_;
 };
 
 // =============================================================================
@@ -121,13 +224,17 @@ inline void register_class_handler(
     const std::string& class_name,
     sync_handler_t sync,
     async_handler_t async,
-    create_handler_t create)
+    create_handler_t create,
+    std::map<std::string, task_priority, std::less<>> async_priorities = {},
+    member_tables members = {})
 {
     dispatcher_registry::instance().register_class(class_name, {
         class_name,
         std::move(sync),
         std::move(async),
-        std::move(create)
+        std::move(create),
+        std::move(async_priorities),
+        std::move(members)
     });
 }
 
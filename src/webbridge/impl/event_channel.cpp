@@ -0,0 +1,175 @@
+#include "event_channel.h"
+#include "serialization_arena.h"
+
+#include <unordered_map>
+#include <mutex>
+
+namespace webbridge::impl {
+
+namespace {
+
+size_t round_up_pow2(size_t n) {
+	size_t result = 1;
+	while (result < n) {
+		result <<= 1;
+	}
+	return result;
+}
+
+// configure() races with the first publish() only at startup; a plain
+// mutex here is fine because the hot path never takes it.
+std::mutex g_init_mutex;
+
+} // namespace
+
+event_channel& event_channel::instance() {
+	static event_channel inst;
+	return inst;
+}
+
+void event_channel::configure(size_t capacity, event_overflow_policy policy) {
+	std::lock_guard lock(g_init_mutex);
+	if (m_initialized.load(std::memory_order_acquire)) {
+		return; // Ring already in use - keep it consistent
+	}
+	m_requested_capacity = capacity > 0 ? capacity : 1024;
+	m_policy = policy;
+}
+
+void event_channel::ensure_initialized() {
+	if (m_initialized.load(std::memory_order_acquire)) {
+		return;
+	}
+	std::lock_guard lock(g_init_mutex);
+	if (m_initialized.load(std::memory_order_acquire)) {
+		return;
+	}
+	auto capacity = round_up_pow2(m_requested_capacity);
+	m_cells = std::make_unique<cell[]>(capacity);
+	for (size_t i = 0; i < capacity; ++i) {
+		m_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+	m_mask = capacity - 1;
+	m_initialized.store(true, std::memory_order_release);
+}
+
+// Vyukov bounded MPMC queue: each cell carries a sequence number that
+// encodes whether it is free for the current producer/consumer lap.
+bool event_channel::try_push(record&& rec) {
+	size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+	for (;;) {
+		cell& c = m_cells[pos & m_mask];
+		size_t seq = c.sequence.load(std::memory_order_acquire);
+		intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+		if (diff == 0) {
+			if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				c.data = std::move(rec);
+				c.sequence.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+		} else if (diff < 0) {
+			return false; // Full
+		} else {
+			pos = m_enqueue_pos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+bool event_channel::try_pop(record& out) {
+	size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+	for (;;) {
+		cell& c = m_cells[pos & m_mask];
+		size_t seq = c.sequence.load(std::memory_order_acquire);
+		intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+		if (diff == 0) {
+			if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				out = std::move(c.data);
+				c.sequence.store(pos + m_mask + 1, std::memory_order_release);
+				return true;
+			}
+		} else if (diff < 0) {
+			return false; // Empty
+		} else {
+			pos = m_dequeue_pos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void event_channel::publish(
+	webview::webview& w,
+	std::string object_id,
+	std::string event_name,
+	std::string args_json)
+{
+	ensure_initialized();
+
+	record rec{&w, std::move(object_id), std::move(event_name), std::move(args_json)};
+
+	while (!try_push(std::move(rec))) {
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		if (m_policy == event_overflow_policy::drop_newest) {
+			return;
+		}
+		// drop_oldest: make room by discarding the head, then retry
+		record discard;
+		if (!try_pop(discard)) {
+			return; // Lost the race against consumers - ring drained
+		}
+	}
+
+	// Schedule exactly one drain while records are pending
+	bool expected = false;
+	if (m_drain_scheduled.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+		webview::webview* ptr = &w;
+		w.dispatch([this, ptr]() {
+			drain(ptr);
+		});
+	}
+}
+
+void event_channel::drain(webview::webview* scheduled_on) {
+	m_drain_scheduled.store(false, std::memory_order_release);
+
+	// Group batches per webview; in the common single-window case this
+	// yields exactly one eval for the whole burst. The batch for the
+	// scheduling webview is eval'd directly, so it can live in an arena
+	// buffer and reuse the capacity of the previous drain; batches for
+	// other webviews are moved into their dispatch and need ownership.
+	arena_buffer local_buffer;
+	auto& local_batch = local_buffer.str();
+	std::unordered_map<webview::webview*, std::string> other_batches;
+
+	record rec;
+	while (try_pop(rec)) {
+		auto& js = (rec.webview_ptr == scheduled_on)
+			? local_batch
+			: other_batches[rec.webview_ptr];
+		if (js.empty()) {
+			js = "window.__webbridge_emit_batch([";
+		} else {
+			js += ',';
+		}
+		js += "[\"";
+		js += rec.object_id;
+		js += "\",\"";
+		js += rec.event_name;
+		js += "\",";
+		js += rec.args_json; // Serialized JSON array
+		js += ']';
+	}
+
+	if (!local_batch.empty()) {
+		local_batch += "])";
+		scheduled_on->eval(local_batch);
+	}
+
+	for (auto& [w, js] : other_batches) {
+		js += "])";
+		// eval must run on the owning webview's UI thread
+		w->dispatch([w, code = std::move(js)]() {
+			w->eval(code);
+		});
+	}
+}
+
+} // namespace webbridge::impl
@@ -0,0 +1,97 @@
+#pragma once
+
+/**
+ * WebBridge Event Channel
+ *
+ * event<Args...>::emit() used to schedule one webview::dispatch() plus
+ * one __webbridge_emit eval per emission. A burst of 10k events from a
+ * real-time worker thread therefore queued 10k dispatches on the UI
+ * message pump.
+ *
+ * The event channel decouples emitters from delivery: emit() pushes a
+ * pre-serialized record into a bounded lock-free MPMC ring buffer
+ * (Vyukov-style, sequence-numbered cells), and a drainer - scheduled at
+ * most once while records are pending - delivers everything in a single
+ * batched __webbridge_emit_batch eval.
+ *
+ * The buffer is bounded on purpose: a stalled UI must not let a fast
+ * producer grow memory without limit. On overflow either the oldest
+ * record is dropped (default - newest data wins, matches live telemetry)
+ * or the newest one is rejected.
+ */
+
+#include <webview/webview.h>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <memory>
+
+namespace webbridge::impl {
+
+enum class event_overflow_policy {
+	drop_oldest,	// Overwrite the oldest pending event (default)
+	drop_newest		// Reject the new event
+};
+
+class event_channel {
+public:
+	static event_channel& instance();
+
+	/**
+	 * Configures ring capacity (rounded up to a power of two) and the
+	 * overflow policy. Must be called before the first emit; later
+	 * calls are ignored once the ring is in use.
+	 */
+	void configure(size_t capacity, event_overflow_policy policy);
+
+	/**
+	 * Publishes one event for batched delivery. args_json must be a
+	 * serialized JSON array of the event arguments.
+	 * Thread-safe, lock-free; may be called from real-time threads.
+	 */
+	void publish(
+		webview::webview& w,
+		std::string object_id,
+		std::string event_name,
+		std::string args_json);
+
+	/**
+	 * Number of events dropped due to overflow since startup.
+	 */
+	uint64_t dropped() const {
+		return m_dropped.load(std::memory_order_relaxed);
+	}
+
+private:
+	event_channel() = default;
+
+	struct record {
+		webview::webview* webview_ptr = nullptr;
+		std::string object_id;
+		std::string event_name;
+		std::string args_json;
+	};
+
+	struct cell {
+		std::atomic<size_t> sequence{0};
+		record data;
+	};
+
+	void ensure_initialized();
+	bool try_push(record&& rec);
+	bool try_pop(record& out);
+	void drain(webview::webview* scheduled_on);
+
+	std::unique_ptr<cell[]> m_cells;
+	size_t m_mask = 0;
+	std::atomic<size_t> m_enqueue_pos{0};
+	std::atomic<size_t> m_dequeue_pos{0};
+	std::atomic<bool> m_drain_scheduled{false};
+	std::atomic<uint64_t> m_dropped{0};
+	std::atomic<bool> m_initialized{false};
+
+	size_t m_requested_capacity = 1024;
+	event_overflow_policy m_policy = event_overflow_policy::drop_oldest;
+};
+
+} // namespace webbridge::impl
@@ -0,0 +1,82 @@
+#include "fast_parse.h"
+#include "trace.h"
+
+#include <simdjson.h>
+#include <atomic>
+#include <cstdint>
+
+namespace webbridge::impl {
+
+namespace {
+
+std::atomic<size_t> g_simd_threshold{256 * 1024};
+
+// Rekursive Umsetzung simdjson-DOM -> nlohmann-DOM. Zahlen, Bools und
+// die UTF-8-Validierung sind hier schon erledigt; es werden nur noch
+// fertige Werte übernommen.
+nlohmann::json to_nlohmann(simdjson::dom::element elem) {
+	switch (elem.type()) {
+	case simdjson::dom::element_type::ARRAY: {
+		auto arr = nlohmann::json::array();
+		for (simdjson::dom::element child : simdjson::dom::array(elem)) {
+			arr.push_back(to_nlohmann(child));
+		}
+		return arr;
+	}
+	case simdjson::dom::element_type::OBJECT: {
+		auto obj = nlohmann::json::object();
+		for (auto field : simdjson::dom::object(elem)) {
+			obj[std::string(field.key)] = to_nlohmann(field.value);
+		}
+		return obj;
+	}
+	case simdjson::dom::element_type::INT64:
+		return int64_t(elem);
+	case simdjson::dom::element_type::UINT64:
+		return uint64_t(elem);
+	case simdjson::dom::element_type::DOUBLE:
+		return double(elem);
+	case simdjson::dom::element_type::STRING:
+		return std::string(std::string_view(elem));
+	case simdjson::dom::element_type::BOOL:
+		return bool(elem);
+	case simdjson::dom::element_type::NULL_VALUE:
+	default:
+		return nullptr;
+	}
+}
+
+} // namespace
+
+void set_simd_parse_threshold(size_t bytes) {
+	g_simd_threshold.store(bytes, std::memory_order_relaxed);
+}
+
+size_t get_simd_parse_threshold() {
+	return g_simd_threshold.load(std::memory_order_relaxed);
+}
+
+nlohmann::json parse_request(const std::string& req) {
+	const auto threshold = g_simd_threshold.load(std::memory_order_relaxed);
+	if (threshold == 0 || req.size() < threshold) {
+		return nlohmann::json::parse(req);
+	}
+
+	trace_span span("parse.simd", [&] {
+		return "parse(" + std::to_string(req.size()) + " bytes)";
+	});
+
+	// Der Parser (und damit seine internen Puffer) wird pro Thread
+	// wiederverwendet - Folge-Uploads parsen ohne Re-Allokation
+	thread_local simdjson::dom::parser parser;
+	simdjson::dom::element root;
+	auto error = parser.parse(req.data(), req.size()).get(root);
+	if (error) {
+		// Fehlerpfad über nlohmann: gleiche Exception-Typen und
+		// Fehlermeldungen wie der Normalpfad, kein zweites Fehlerformat
+		return nlohmann::json::parse(req);
+	}
+	return to_nlohmann(root);
+}
+
+} // namespace webbridge::impl
@@ -0,0 +1,44 @@
+#pragma once
+
+/**
+ * WebBridge Fast Parse
+ *
+ * Größengesteuerter Parse-Pfad für Request-Payloads. Kleine Requests
+ * (der Normalfall, siehe doc/performance.md) bleiben bei
+ * nlohmann::json::parse - der Umweg lohnt dort nicht. Oberhalb der
+ * Schwelle (Default 256 KiB, typisch Rezept-Uploads im MB-Bereich)
+ * übernimmt simdjson die Stage-1/2-Arbeit (UTF-8-Validierung,
+ * Strukturerkennung, Number-Parsing) mit SIMD und das Ergebnis wird in
+ * eine nlohmann-DOM umgesetzt.
+ *
+ * Die Umsetzung statt eines echten Lazy-Adapters ist Absicht: die
+ * generierten Handler, invoke_and_serialize und expand_request_envelopes
+ * arbeiten durchgehend auf const nlohmann::json& - dieses Interface
+ * bleibt unangetastet. Der teure Teil (Text -> Werte) läuft trotzdem
+ * über SIMD; der Aufbau der nlohmann-Knoten kopiert nur noch fertige
+ * Werte ohne erneutes String-Scannen.
+ */
+
+#include <nlohmann/json.hpp>
+#include <string>
+#include <cstddef>
+
+namespace webbridge::impl {
+
+/**
+ * Schwelle in Bytes, ab der simdjson übernimmt.
+ * 0 deaktiviert den SIMD-Pfad komplett (alles über nlohmann).
+ * Vor run() setzen; Default 256 KiB.
+ */
+void set_simd_parse_threshold(size_t bytes);
+size_t get_simd_parse_threshold();
+
+/**
+ * Parst einen Request-Payload in eine nlohmann-DOM; wählt den Pfad
+ * anhand der Payload-Größe. Wirft bei ungültigem JSON wie
+ * nlohmann::json::parse (der simdjson-Pfad fällt bei Parse-Fehlern
+ * auf nlohmann zurück, damit die Fehlermeldungen identisch bleiben).
+ */
+nlohmann::json parse_request(const std::string& req);
+
+} // namespace webbridge::impl
@@ -0,0 +1,33 @@
+#include "metrics.h"
+
+namespace webbridge::impl {
+
+bridge_metrics& bridge_metrics::instance() {
+	static bridge_metrics metrics;
+	return metrics;
+}
+
+double bridge_metrics::percentile_us(const bucket_counts& delta, double p) noexcept {
+	uint64_t total = 0;
+	for (auto count : delta) {
+		total += count;
+	}
+	if (total == 0) {
+		return 0.0;
+	}
+
+	// Rang des gesuchten Samples (1-basiert), dann den Bucket suchen,
+	// in dem die kumulierte Zählung den Rang erreicht
+	const auto rank = static_cast<uint64_t>(p * static_cast<double>(total - 1)) + 1;
+	uint64_t cumulative = 0;
+	for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+		cumulative += delta[i];
+		if (cumulative >= rank) {
+			// Obere Bucket-Grenze: Bucket i zählt Latenzen < 2^i µs
+			return i == 0 ? 0.0 : static_cast<double>(1ull << i);
+		}
+	}
+	return static_cast<double>(1ull << (LATENCY_BUCKETS - 1));
+}
+
+} // namespace webbridge::impl
@@ -0,0 +1,138 @@
+#pragma once
+
+/**
+ * WebBridge Metrics
+ *
+ * Live-Zähler für die Bridge-Hot-Paths. Anders als das Span-Tracing
+ * (trace.h), das für Offline-Analyse in eine Datei schreibt, sind diese
+ * Zähler IMMER aktiv und werden zur Laufzeit ausgelesen - die
+ * BridgeMetrics-Klasse (src/BridgeMetrics.h) stellt sie dem Frontend als
+ * ganz normale webbridge-Properties zur Verfügung.
+ *
+ * Design:
+ *   - Der Schreibpfad besteht ausschließlich aus relaxed fetch_add auf
+ *     vorab allozierten Atomics: kein Lock, keine Allokation, keine
+ *     Map. Ein instrumentierter Build ist damit auslieferbar.
+ *   - Aufrufe werden pro Klasse (dichte class_id aus dispatcher.h) und
+ *     Operation gezählt; der Sampler bildet aus den Deltas Raten.
+ *   - Latenzen landen in Log2-Histogrammen (µs); Perzentile werden erst
+ *     beim Auslesen aus dem Fenster-Delta geschätzt, nie auf dem
+ *     Hot-Path.
+ *   - Die Leseseite ist nur näherungsweise konsistent (relaxed Reads
+ *     über mehrere Zähler) - für ein Dashboard völlig ausreichend.
+ */
+
+#include <atomic>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+namespace webbridge::impl {
+
+class bridge_metrics {
+public:
+	static bridge_metrics& instance();
+
+	// Operation-Slots pro Klasse: 0-3 entsprechen den Sync-Op-Codes des
+	// Wire-Protokolls (prop/const/call/snapshot), danach async und create.
+	static constexpr size_t OP_ASYNC = 4;
+	static constexpr size_t OP_CREATE = 5;
+	static constexpr size_t OP_SLOTS = 6;
+
+	// Dichte class_ids beginnen bei 0; Klassen jenseits der Kapazität
+	// werden still nicht gezählt statt zu allozieren oder zu werfen.
+	static constexpr size_t MAX_CLASSES = 64;
+
+	// Log2-Buckets in µs: Bucket i zählt Latenzen < 2^i µs.
+	// Bucket 31 deckt > 35 Minuten ab - mehr braucht niemand.
+	static constexpr size_t LATENCY_BUCKETS = 32;
+
+	using bucket_counts = std::array<uint64_t, LATENCY_BUCKETS>;
+
+	// --- Schreibseite (Dispatcher-Bindings) ---
+
+	void count_call(uint32_t class_id, size_t op) noexcept {
+		if (class_id < MAX_CLASSES && op < OP_SLOTS) {
+			m_calls[class_id][op].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void record_sync_latency(uint64_t us) noexcept {
+		record(m_sync_latency, us);
+	}
+
+	void record_async_latency(uint64_t us) noexcept {
+		record(m_async_latency, us);
+	}
+
+	void add_bytes_in(size_t n) noexcept {
+		m_bytes_in.fetch_add(n, std::memory_order_relaxed);
+	}
+
+	void add_bytes_out(size_t n) noexcept {
+		m_bytes_out.fetch_add(n, std::memory_order_relaxed);
+	}
+
+	// --- Leseseite (Sampler) ---
+
+	uint64_t call_count(uint32_t class_id, size_t op) const noexcept {
+		if (class_id >= MAX_CLASSES || op >= OP_SLOTS) {
+			return 0;
+		}
+		return m_calls[class_id][op].load(std::memory_order_relaxed);
+	}
+
+	uint64_t bytes_in() const noexcept {
+		return m_bytes_in.load(std::memory_order_relaxed);
+	}
+
+	uint64_t bytes_out() const noexcept {
+		return m_bytes_out.load(std::memory_order_relaxed);
+	}
+
+	bucket_counts sync_latency_buckets() const noexcept {
+		return snapshot(m_sync_latency);
+	}
+
+	bucket_counts async_latency_buckets() const noexcept {
+		return snapshot(m_async_latency);
+	}
+
+	/**
+	 * Schätzt ein Perzentil (p in [0,1]) aus einem Bucket-DELTA, d.h.
+	 * der Differenz zweier Snapshots - so beziehen sich die Perzentile
+	 * auf das Sample-Fenster statt auf die Prozesslaufzeit. Liefert die
+	 * obere Bucket-Grenze in µs; 0 wenn das Fenster leer ist.
+	 */
+	static double percentile_us(const bucket_counts& delta, double p) noexcept;
+
+private:
+	using histogram = std::array<std::atomic<uint64_t>, LATENCY_BUCKETS>;
+
+	static void record(histogram& h, uint64_t us) noexcept {
+		// bit_width(0) == 0, bit_width(1) == 1, ... - Bucket i zählt
+		// Latenzen mit oberer Grenze 2^i µs
+		auto bucket = static_cast<size_t>(std::bit_width(us));
+		if (bucket >= LATENCY_BUCKETS) {
+			bucket = LATENCY_BUCKETS - 1;
+		}
+		h[bucket].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static bucket_counts snapshot(const histogram& h) noexcept {
+		bucket_counts out{};
+		for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+			out[i] = h[i].load(std::memory_order_relaxed);
+		}
+		return out;
+	}
+
+	std::array<std::array<std::atomic<uint64_t>, OP_SLOTS>, MAX_CLASSES> m_calls{};
+	histogram m_sync_latency{};
+	histogram m_async_latency{};
+	std::atomic<uint64_t> m_bytes_in{0};
+	std::atomic<uint64_t> m_bytes_out{0};
+};
+
+} // namespace webbridge::impl
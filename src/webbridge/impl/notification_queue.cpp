@@ -0,0 +1,213 @@
+#include "notification_queue.h"
+#include "serialization_arena.h"
+#include "trace.h"
+
+#include <nlohmann/json.hpp>
+#include <vector>
+
+namespace webbridge::impl {
+
+namespace {
+
+// Delta-Payloads stammen ausschließlich aus make_delta_payload()
+// (binding_helpers.h) - der Prefix-Check reicht zur Unterscheidung
+// Patch vs. Vollwert-Fallback.
+bool is_patch_payload(const std::string& json) {
+	return json.starts_with("{\"$patch\"");
+}
+
+} // namespace
+
+notification_coalescer& notification_coalescer::instance() {
+	static notification_coalescer inst;
+	return inst;
+}
+
+void notification_coalescer::enqueue(
+	webview::webview& w,
+	const std::string& object_id,
+	const std::string& prop_name,
+	std::string value_json)
+{
+	bool schedule = false;
+	{
+		std::lock_guard lock(m_mutex);
+		auto& state = m_states[&w];
+
+		auto key = object_id + '\x1f' + prop_name;
+		state.dirty[key] = {object_id, prop_name, std::move(value_json)};
+
+		if (!state.flush_scheduled) {
+			state.flush_scheduled = true;
+			schedule = true;
+		}
+	}
+
+	// One dispatch per pump cycle - all changes recorded until the
+	// dispatched lambda actually runs ride along in the same flush.
+	if (schedule) {
+		webview::webview* ptr = &w;
+		w.dispatch([this, ptr]() {
+			flush(ptr);
+		});
+	}
+}
+
+void notification_coalescer::enqueue_delta(
+	webview::webview& w,
+	const std::string& object_id,
+	const std::string& prop_name,
+	std::string value_json)
+{
+	bool schedule = false;
+	{
+		std::lock_guard lock(m_mutex);
+		auto& state = m_states[&w];
+
+		auto key = object_id + '\x1f' + prop_name;
+		auto it = state.dirty.find(key);
+		if (it == state.dirty.end() || !is_patch_payload(value_json)) {
+			// Erster Eintrag im Flush-Fenster oder Vollwert-Fallback
+			state.dirty[key] = {object_id, prop_name, std::move(value_json)};
+		} else {
+			auto& pending = it->second.value_json;
+			try {
+				auto incoming = nlohmann::json::parse(value_json);
+				if (is_patch_payload(pending)) {
+					// Patch auf Patch: Op-Listen konkatenieren - das
+					// Ergebnis ist der Diff vom letzten Flush-Stand zum
+					// aktuellen Wert.
+					auto merged = nlohmann::json::parse(pending);
+					auto& ops = merged["$patch"];
+					for (auto& op : incoming["$patch"]) {
+						ops.push_back(std::move(op));
+					}
+					pending = merged.dump();
+				} else {
+					// Patch auf wartenden Vollwert: direkt anwenden,
+					// der Eintrag bleibt ein Vollwert.
+					pending = nlohmann::json::parse(pending)
+						.patch(incoming["$patch"]).dump();
+				}
+			} catch (const nlohmann::json::exception&) {
+				// Payload-Paare stammen aus einer Quelle und passen
+				// zusammen; im Zweifel gewinnt der neue Eintrag.
+				pending = std::move(value_json);
+			}
+		}
+
+		if (!state.flush_scheduled) {
+			state.flush_scheduled = true;
+			schedule = true;
+		}
+	}
+
+	if (schedule) {
+		webview::webview* ptr = &w;
+		w.dispatch([this, ptr]() {
+			flush(ptr);
+		});
+	}
+}
+
+void notification_coalescer::enqueue_eval(webview::webview& w, std::function<void()> fn) {
+	bool schedule = false;
+	{
+		std::lock_guard lock(m_mutex);
+		auto& state = m_states[&w];
+		state.deferred.push_back(std::move(fn));
+
+		if (!state.flush_scheduled) {
+			state.flush_scheduled = true;
+			schedule = true;
+		}
+	}
+
+	if (schedule) {
+		webview::webview* ptr = &w;
+		w.dispatch([this, ptr]() {
+			flush(ptr);
+		});
+	}
+}
+
+void notification_coalescer::clear(webview::webview* w) {
+	std::lock_guard lock(m_mutex);
+	m_states.erase(w);
+}
+
+void notification_coalescer::flush(webview::webview* w) {
+	// Phase 1: deferred Auswertungen (computed properties) laufen VOR
+	// dem Einsammeln der dirty-Map - ihre enqueue()s reiten im selben
+	// Flush mit. flush_scheduled bleibt dabei gesetzt, damit sie keinen
+	// zusätzlichen Dispatch anstoßen.
+	std::vector<std::function<void()>> deferred;
+	{
+		std::lock_guard lock(m_mutex);
+		auto it = m_states.find(w);
+		if (it == m_states.end()) {
+			return;
+		}
+		deferred.swap(it->second.deferred);
+	}
+	for (auto& fn : deferred) {
+		fn();
+	}
+
+	bool reschedule = false;
+	std::unordered_map<std::string, pending_notification> dirty;
+	{
+		std::lock_guard lock(m_mutex);
+		auto it = m_states.find(w);
+		if (it == m_states.end()) {
+			return;
+		}
+		dirty.swap(it->second.dirty);
+		if (it->second.deferred.empty()) {
+			it->second.flush_scheduled = false;
+		} else {
+			// Während Phase 1 neu registrierte Evals: nächster Zyklus
+			reschedule = true;
+		}
+	}
+	if (reschedule) {
+		w->dispatch([this, w]() {
+			flush(w);
+		});
+	}
+
+	if (dirty.empty()) {
+		return;
+	}
+
+	trace_span span("notify", [&] { return "flush(" + std::to_string(dirty.size()) + ")"; });
+
+	// Build one eval carrying all changed values:
+	// __webbridge_notify_batch([[objectId, propName, value], ...])
+	// value_json is raw JSON text and can be embedded directly. The
+	// buffer comes from the arena, so steady-state flushes reuse the
+	// capacity of previous ones instead of reallocating.
+	arena_buffer buffer;
+	auto& js = buffer.str();
+	js += "window.__webbridge_notify_batch([";
+
+	bool first = true;
+	for (const auto& [key, entry] : dirty) {
+		if (!first) {
+			js += ',';
+		}
+		first = false;
+		js += "[\"";
+		js += entry.object_id;
+		js += "\",\"";
+		js += entry.prop_name;
+		js += "\",";
+		js += entry.value_json;
+		js += ']';
+	}
+	js += "])";
+
+	w->eval(js);
+}
+
+} // namespace webbridge::impl
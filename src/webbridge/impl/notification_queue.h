@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * WebBridge Notification Coalescing
+ *
+ * Without coalescing, every property<T>::set() schedules its own
+ * webview::dispatch() plus a separate __webbridge_notify eval. At high
+ * update rates (hundreds of properties at 50 Hz) this floods the WebView
+ * message pump with thousands of tiny evals per second and stalls the
+ * UI thread.
+ *
+ * The coalescer records changed properties in a dirty set instead.
+ * The first change per pump cycle schedules ONE dispatch; when it runs,
+ * all pending changes are delivered in a single batched
+ * __webbridge_notify_batch eval. Per property only the latest value
+ * survives (last-writer-wins) - intermediate values were never going to
+ * be rendered anyway.
+ */
+
+#include <webview/webview.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <functional>
+#include <mutex>
+
+namespace webbridge::impl {
+
+class notification_coalescer {
+public:
+	static notification_coalescer& instance();
+
+	/**
+	 * Records a property change for batched delivery.
+	 * value_json must already be serialized for the wire (JSON text or
+	 * CBOR envelope, see wire_protocol.h).
+	 * Thread-safe; may be called from any thread.
+	 */
+	void enqueue(
+		webview::webview& w,
+		const std::string& object_id,
+		const std::string& prop_name,
+		std::string value_json);
+
+	/**
+	 * Wie enqueue(), aber für Payloads von delta-aktivierten Properties
+	 * ({"$patch": [...]} bzw. Vollwert-Fallback). Last-writer-wins würde
+	 * hier Zwischen-Patches verlieren und die JS-Seite gegen eine falsche
+	 * Basis patchen lassen - stattdessen werden aufeinanderfolgende
+	 * Patches derselben Property bis zum Flush konkateniert (RFC-6902-
+	 * Patches komponieren sequenziell). Trifft ein Patch auf einen noch
+	 * wartenden Vollwert, wird er direkt auf diesen angewendet; ein
+	 * Vollwert ersetzt weiterhin alles Wartende.
+	 * Thread-safe; may be called from any thread.
+	 */
+	void enqueue_delta(
+		webview::webview& w,
+		const std::string& object_id,
+		const std::string& prop_name,
+		std::string value_json);
+
+	/**
+	 * Registriert eine deferred Auswertung für den nächsten Flush-
+	 * Zyklus: fn läuft auf dem UI-Thread, BEVOR die dirty-Map
+	 * eingesammelt wird - von fn enqueue()te Notifications reiten also
+	 * im selben Flush mit. Genau ein Lauf pro Registrierung.
+	 * computed_property kollabiert darüber N Input-Änderungen eines
+	 * Zyklus in höchstens eine Neuberechnung.
+	 * Thread-safe; may be called from any thread.
+	 */
+	void enqueue_eval(webview::webview& w, std::function<void()> fn);
+
+	/**
+	 * Drops all pending notifications for a webview.
+	 * Called when a webview is torn down.
+	 */
+	void clear(webview::webview* w);
+
+private:
+	notification_coalescer() = default;
+
+	struct pending_notification {
+		std::string object_id;
+		std::string prop_name;
+		std::string value_json;
+	};
+
+	struct webview_state {
+		// Keyed by object_id + '\x1f' + prop_name for last-writer-wins
+		std::unordered_map<std::string, pending_notification> dirty;
+		// Deferred evals (computed properties), run before the dirty
+		// map is collected
+		std::vector<std::function<void()>> deferred;
+		bool flush_scheduled = false;
+	};
+
+	void flush(webview::webview* w);
+
+	std::mutex m_mutex;
+	std::unordered_map<webview::webview*, webview_state> m_states;
+};
+
+} // namespace webbridge::impl
@@ -1,12 +1,39 @@
 #pragma once
 
+/**
+ * WebBridge Object Registry
+ *
+ * get<T>() sits on every single sync/async dispatch, so its cost is
+ * pure per-call overhead. The registry therefore keys objects by dense
+ * integer handles instead of hashing formatted string ids:
+ *
+ *   - A handle encodes shard | slot index | generation counter.
+ *   - Slots live in fixed-size chunks whose addresses never move, and
+ *     the per-shard chunk table holds atomic pointers - the read path
+ *     is an atomic chunk load, an atomic shared_ptr load and a
+ *     generation check. No lock, no string hash, no map lookup.
+ *   - The generation counter is bumped on every remove(), so a stale
+ *     handle (use after destroy) simply misses instead of resolving to
+ *     a recycled slot.
+ *   - Writes (register/remove) take a small per-shard mutex; shards
+ *     keep concurrent creations/destructions from serializing.
+ *
+ * At the JS boundary objects keep their string ids ("{type}_{handle}")
+ * for compatibility; the numeric handle is parsed back out on entry.
+ */
+
+#include "trace.h"
+
 #include <memory>
 #include <string>
-#include <unordered_map>
-#include <shared_mutex>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <mutex>
 #include <atomic>
 #include <format>
-#include <optional>
+#include <charconv>
+#include <cstdint>
 
 namespace webbridge::impl {
 
@@ -14,6 +41,11 @@ class object_registry {
 public:
 	using object_ptr = std::shared_ptr<void>;
 
+	// Per-window registries are owned by bridge_context; instance()
+	// remains the process-wide default for standalone use (benchmarks,
+	// register_type<T> without a context).
+	object_registry() = default;
+
 	static object_registry& instance() {
 		static object_registry registry;
 		return registry;
@@ -21,43 +53,255 @@ public:
 
 	template<typename T>
 	std::string register_object(std::shared_ptr<T> obj, std::string_view type_name) {
-		auto id = generate_id(type_name);
-		std::unique_lock lock(m_mutex);
-		m_objects[id] = std::static_pointer_cast<void>(obj);
-		return id;
+		auto handle = allocate_slot(std::static_pointer_cast<void>(std::move(obj)));
+		return std::format("{}_{}", type_name, handle);
 	}
 
 	template<typename T>
-	std::shared_ptr<T> get(const std::string& id) {
-		std::shared_lock lock(m_mutex);
-		auto it = m_objects.find(id);
-		if (it == m_objects.end()) {
+	std::shared_ptr<T> get(std::string_view id) {
+		uint64_t handle;
+		if (!parse_handle(id, handle)) {
+			return nullptr;
+		}
+
+		auto shard_index = static_cast<size_t>((handle >> INDEX_BITS) & SHARD_MASK);
+		auto index = static_cast<uint32_t>(handle & INDEX_MASK);
+		auto generation = static_cast<uint32_t>(handle >> (INDEX_BITS + SHARD_BITS));
+
+		auto& s = m_shards[shard_index];
+		slot* sl = s.slot_at(index);
+		if (!sl) {
+			return nullptr;
+		}
+
+		// Generation check before AND after the pointer load: a slot
+		// recycled mid-read changes its generation, so stale handles
+		// never resolve to the new occupant.
+		if (sl->generation.load(std::memory_order_acquire) != generation) {
+			return nullptr;
+		}
+		auto ptr = sl->object.load(std::memory_order_acquire);
+		if (sl->generation.load(std::memory_order_acquire) != generation) {
 			return nullptr;
 		}
-		return std::static_pointer_cast<T>(it->second);
+		return std::static_pointer_cast<T>(ptr);
+	}
+
+	bool remove(std::string_view id) {
+		uint64_t handle;
+		if (!parse_handle(id, handle)) {
+			return false;
+		}
+
+		auto shard_index = static_cast<size_t>((handle >> INDEX_BITS) & SHARD_MASK);
+		auto index = static_cast<uint32_t>(handle & INDEX_MASK);
+		auto generation = static_cast<uint32_t>(handle >> (INDEX_BITS + SHARD_BITS));
+
+		auto& s = m_shards[shard_index];
+		std::lock_guard lock(s.mutex);
+
+		slot* sl = s.slot_at(index);
+		if (!sl || sl->generation.load(std::memory_order_acquire) != generation) {
+			return false;
+		}
+
+		// Invalidate the handle first, then release the object
+		sl->generation.fetch_add(1, std::memory_order_acq_rel);
+		sl->object.store(nullptr, std::memory_order_release);
+		s.free_list.push_back(index);
+		m_live.fetch_sub(1, std::memory_order_relaxed);
+		s_total_live.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool contains(std::string_view id) const {
+		return const_cast<object_registry*>(this)->get<void>(id) != nullptr;
+	}
+
+	/**
+	 * Anzahl lebender Objekte in DIESER Registry (Momentaufnahme).
+	 */
+	size_t live_count() const {
+		return m_live.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Anzahl lebender Objekte über ALLE Registries (bridge_context legt
+	 * eine pro Webview an) - das ist der Wert fürs Metrics-Dashboard.
+	 */
+	static size_t total_live() {
+		return s_total_live.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Leak-Diagnose für Langläufer-Sessions: zählt lebende Objekte und
+	 * wie viele davon älter als min_age_us sind. Objekte, die Stunden
+	 * überleben, obwohl das Frontend längst weiternavigiert ist, sind
+	 * fast immer vergessene destroy()-Aufrufe, die der GC-Pfad (noch)
+	 * nicht eingesammelt hat.
+	 */
+	struct age_report {
+		size_t live = 0;			// lebende Objekte gesamt
+		size_t older = 0;			// davon älter als min_age_us
+		int64_t oldest_age_us = 0;	// Alter des ältesten Objekts
+	};
+
+	age_report leak_report(int64_t min_age_us) {
+		age_report report;
+		const auto now_us = trace_now_us();
+		for (auto& s : m_shards) {
+			std::lock_guard lock(s.mutex);
+			for (uint32_t index = 0; index < s.next_index; ++index) {
+				slot* sl = s.slot_at(index);
+				if (!sl || !sl->object.load(std::memory_order_acquire)) {
+					continue;
+				}
+				report.live++;
+				const auto age_us = now_us - sl->created_us;
+				if (age_us >= min_age_us) {
+					report.older++;
+				}
+				if (age_us > report.oldest_age_us) {
+					report.oldest_age_us = age_us;
+				}
+			}
+		}
+		return report;
 	}
 
-	bool remove(const std::string& id) {
-		std::unique_lock lock(m_mutex);
-		return m_objects.erase(id) > 0;
+	/**
+	 * Notbremse für Sessions ohne funktionierenden GC-Pfad: entfernt
+	 * ALLE Objekte, die älter als min_age_us sind, und liefert die
+	 * Anzahl. VORSICHT: trifft auch Objekte, die das Frontend noch
+	 * referenziert - deren Handles laufen danach ins Leere (die
+	 * Generation-Checks machen daraus saubere Misses, keine Crashes).
+	 * Nur mit großzügiger Schwelle aus App-Code aufrufen.
+	 */
+	size_t sweep_older_than(int64_t min_age_us) {
+		size_t swept = 0;
+		const auto now_us = trace_now_us();
+		for (auto& s : m_shards) {
+			std::lock_guard lock(s.mutex);
+			for (uint32_t index = 0; index < s.next_index; ++index) {
+				slot* sl = s.slot_at(index);
+				if (!sl || !sl->object.load(std::memory_order_acquire)) {
+					continue;
+				}
+				if (now_us - sl->created_us < min_age_us) {
+					continue;
+				}
+				// Gleiche Invalidierungs-Reihenfolge wie remove()
+				sl->generation.fetch_add(1, std::memory_order_acq_rel);
+				sl->object.store(nullptr, std::memory_order_release);
+				s.free_list.push_back(index);
+				m_live.fetch_sub(1, std::memory_order_relaxed);
+				s_total_live.fetch_sub(1, std::memory_order_relaxed);
+				swept++;
+			}
+		}
+		return swept;
 	}
 
-	bool contains(const std::string& id) const {
-		std::shared_lock lock(m_mutex);
-		return m_objects.contains(id);
+	/**
+	 * Cross-Context-Sharing: übernimmt das Objekt hinter id aus source
+	 * unter einem NEUEN Handle in diese Registry. Beide Registries
+	 * halten danach eine eigene shared_ptr-Referenz, remove() wirkt nur
+	 * lokal. Liefert das neue "{type}_{handle}"-Id (leer bei Miss).
+	 */
+	std::string adopt(object_registry& source, std::string_view id) {
+		auto obj = source.get<void>(id);
+		if (!obj) {
+			return {};
+		}
+		// get() succeeded, so the "{type}_{handle}" split exists
+		auto type_name = id.substr(0, id.rfind('_'));
+		auto handle = allocate_slot(std::move(obj));
+		return std::format("{}_{}", type_name, handle);
 	}
 
 private:
-	object_registry() = default;
+	static constexpr size_t SHARD_BITS = 4;
+	static constexpr size_t SHARD_COUNT = 1u << SHARD_BITS;	// 16 shards
+	static constexpr uint64_t SHARD_MASK = SHARD_COUNT - 1;
+
+	static constexpr size_t INDEX_BITS = 24;				// 16M slots per shard
+	static constexpr uint64_t INDEX_MASK = (1ull << INDEX_BITS) - 1;
+
+	static constexpr size_t CHUNK_BITS = 8;
+	static constexpr size_t CHUNK_SIZE = 1u << CHUNK_BITS;	// 256 slots per chunk
+	static constexpr size_t MAX_CHUNKS = (1u << INDEX_BITS) / CHUNK_SIZE;
 
-	std::string generate_id(std::string_view type_name) {
-		auto counter = m_counter.fetch_add(1, std::memory_order_relaxed);
-		return std::format("{}_{}", type_name, counter);
+	struct slot {
+		std::atomic<uint32_t> generation{0};
+		std::atomic<std::shared_ptr<void>> object{nullptr};
+		// Registrierungszeitpunkt (µs, steady) für die Leak-Diagnose.
+		// Nur unter dem Shard-Mutex geschrieben und gelesen.
+		int64_t created_us = 0;
+	};
+
+	struct shard {
+		// Chunk addresses are published atomically and never change,
+		// so readers index them without taking the mutex.
+		std::array<std::atomic<slot*>, MAX_CHUNKS> chunks{};
+		std::vector<std::unique_ptr<slot[]>> chunk_storage;
+		std::vector<uint32_t> free_list;
+		uint32_t next_index = 0;
+		std::mutex mutex;
+
+		slot* slot_at(uint32_t index) const {
+			slot* chunk = chunks[index >> CHUNK_BITS].load(std::memory_order_acquire);
+			return chunk ? &chunk[index & (CHUNK_SIZE - 1)] : nullptr;
+		}
+	};
+
+	uint64_t allocate_slot(object_ptr obj) {
+		auto shard_index = m_next_shard.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+		auto& s = m_shards[shard_index];
+
+		std::lock_guard lock(s.mutex);
+
+		uint32_t index;
+		if (!s.free_list.empty()) {
+			index = s.free_list.back();
+			s.free_list.pop_back();
+		} else {
+			index = s.next_index++;
+			auto chunk_index = index >> CHUNK_BITS;
+			if (!s.chunks[chunk_index].load(std::memory_order_relaxed)) {
+				auto chunk = std::make_unique<slot[]>(CHUNK_SIZE);
+				s.chunks[chunk_index].store(chunk.get(), std::memory_order_release);
+				s.chunk_storage.push_back(std::move(chunk));
+			}
+		}
+
+		slot* sl = s.slot_at(index);
+		sl->created_us = trace_now_us();
+		sl->object.store(std::move(obj), std::memory_order_release);
+		m_live.fetch_add(1, std::memory_order_relaxed);
+		s_total_live.fetch_add(1, std::memory_order_relaxed);
+
+		auto generation = sl->generation.load(std::memory_order_acquire);
+		return (static_cast<uint64_t>(generation) << (INDEX_BITS + SHARD_BITS))
+			| (static_cast<uint64_t>(shard_index) << INDEX_BITS)
+			| index;
+	}
+
+	// Ids look like "{type}_{handle}" - only the numeric tail matters.
+	static bool parse_handle(std::string_view id, uint64_t& handle) {
+		auto pos = id.rfind('_');
+		if (pos == std::string::npos || pos + 1 >= id.size()) {
+			return false;
+		}
+		auto first = id.data() + pos + 1;
+		auto last = id.data() + id.size();
+		auto [end, ec] = std::from_chars(first, last, handle);
+		return ec == std::errc{} && end == last;
 	}
 
-	mutable std::shared_mutex m_mutex;
-	std::unordered_map<std::string, object_ptr> m_objects;
-	std::atomic<uint64_t> m_counter{0};
+	std::array<shard, SHARD_COUNT> m_shards;
+	std::atomic<uint64_t> m_next_shard{0};
+	std::atomic<size_t> m_live{0};
+	static inline std::atomic<size_t> s_total_live{0};
 };
 
 } // namespace webbridge::impl
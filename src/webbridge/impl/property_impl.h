@@ -1,11 +1,98 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <shared_mutex>
 #include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace webbridge::impl {
 
+// =============================================================================
+// Storage-Auswahl zur Compile-Zeit
+// =============================================================================
+
+/// Werte, die ohne Lock in einem std::atomic<T> gehalten werden können
+/// (bool, int, enums, kleine PODs). Lebt hier statt in concepts.h, weil
+/// concepts.h object.h zieht und das einen Include-Zyklus ergäbe.
+template<typename T>
+concept atomically_storable =
+	std::is_trivially_copyable_v<T>
+	&& std::is_copy_constructible_v<T>
+	&& std::is_move_constructible_v<T>;
+
+/**
+ * Standard-Storage: shared_mutex für Strings, Vektoren und andere
+ * nicht-triviale Payloads, deren Kopie nicht atomar passieren kann.
+ */
+template<typename T>
+class property_storage {
+public:
+	T load() const {
+		std::shared_lock lock(mutex_);
+		return value_;
+	}
+
+	// Schreibt nur bei tatsächlicher Änderung; stored erhält dann den
+	// neuen Wert (für den on_changed-Callback außerhalb des Locks).
+	bool store_if_changed(T new_value, T& stored) {
+		std::unique_lock lock(mutex_);
+		if (value_ == new_value) {
+			return false;
+		}
+		value_ = std::move(new_value);
+		stored = value_;
+		return true;
+	}
+
+private:
+	mutable std::shared_mutex mutex_;
+	T value_{};
+};
+
+/**
+ * Fast path für trivially-copyable T: ein std::atomic<T> statt
+ * shared_mutex. Ein property<bool>/<int>/<enum>-Read ist damit ein
+ * einzelner atomic load - kein Lock, kein Writer-Stall, deutlich
+ * kleinerer Footprint für Flags, die der Control-Loop tausendfach pro
+ * Sekunde pollt. (Für kleine T lock-free; größere PODs nutzen den
+ * internen Spinlock von std::atomic und bleiben trotzdem billiger als
+ * ein shared_mutex.)
+ */
+template<typename T>
+	requires atomically_storable<T>
+class property_storage<T> {
+public:
+	T load() const {
+		return value_.load(std::memory_order_acquire);
+	}
+
+	bool store_if_changed(T new_value, T& stored) {
+		// CAS-Loop statt blindem store, damit die Änderungs-Erkennung
+		// (kein Callback bei identischem Wert) unter parallelen
+		// Writern exakt bleibt.
+		T expected = value_.load(std::memory_order_relaxed);
+		do {
+			if (expected == new_value) {
+				return false;
+			}
+		} while (!value_.compare_exchange_weak(
+			expected, new_value,
+			std::memory_order_acq_rel, std::memory_order_relaxed));
+		stored = new_value;
+		return true;
+	}
+
+private:
+	std::atomic<T> value_{};
+};
+
+// =============================================================================
+// Property
+// =============================================================================
+
 template<typename T>
 class property {
 public:
@@ -13,11 +100,13 @@ public:
 
 	property() = default;
 
-	explicit property(T initial) : value_(std::move(initial)) {}
+	explicit property(T initial) {
+		T ignored;
+		storage_.store_if_changed(std::move(initial), ignored);
+	}
 
 	[[nodiscard]] T get() const {
-		std::shared_lock lock(mutex_);
-		return value_;
+		return storage_.load();
 	}
 
 	[[nodiscard]] T operator()() const {
@@ -30,33 +119,207 @@ public:
 	}
 
 	property& set(T newValue) {
+		T stored{};
+		if (!storage_.store_if_changed(std::move(newValue), stored)) {
+			return *this;
+		}
 		callback cb;
+		std::vector<std::function<void()>> observers;
 		{
-			std::unique_lock lock(mutex_);
-			if (value_ == newValue) {
-				return *this;
-			}
-			value_ = std::move(newValue);
+			std::lock_guard lock(callback_mutex_);
 			cb = on_changed_;
+			observers = observers_;
 		}
 		if (cb) {
-			cb(value_);
+			cb(stored);
+		}
+		for (auto& observer : observers) {
+			observer();
 		}
 		return *this;
 	}
 
 	void set_on_changed(callback callback) {
-		std::unique_lock lock(mutex_);
+		std::lock_guard lock(callback_mutex_);
 		on_changed_ = std::move(callback);
 	}
 
+	/**
+	 * Interner Beobachter-Hook für abgeleitete Werte (computed_property):
+	 * wird zusätzlich zum on_changed-Callback bei jeder tatsächlichen
+	 * Änderung gerufen, transportiert aber keinen Wert - der Beobachter
+	 * entscheidet selbst, ob und wann er liest. Observer lassen sich
+	 * nicht abmelden; Inputs und abhängige computed_properties müssen
+	 * daher im selben Objekt leben (gleiche Lebensdauer).
+	 */
+	void add_observer(std::function<void()> observer) {
+		std::lock_guard lock(callback_mutex_);
+		observers_.push_back(std::move(observer));
+	}
+
+	/**
+	 * Schaltet dieses Property auf Delta-Updates um: statt des kompletten
+	 * Werts wandert pro Änderung nur der strukturelle Diff (RFC-6902-
+	 * Patch) gegen den zuletzt versendeten Stand - ein Append an einen
+	 * Log-Vektor mit tausenden Einträgen kostet dann eine einzelne
+	 * add-Op statt der Retransmission des ganzen Containers. Lohnt für
+	 * große Container und JSON-Object-artige Typen mit kleinen
+	 * Änderungen; erzwingt den reinen JSON-Pfad (kein TypedArray-
+	 * Envelope, die Views wären JS-seitig nicht patchbar).
+	 * Im Konstruktor aufrufen, VOR der Registrierung des Objekts!
+	 */
+	void enable_delta_updates() {
+		delta_updates_ = true;
+	}
+
+	[[nodiscard]] bool delta_updates_enabled() const {
+		return delta_updates_;
+	}
+
 	property(const property&) = delete;
 	property& operator=(const property&) = delete;
 
 private:
-	mutable std::shared_mutex mutex_;
-	T value_{};
+	property_storage<T> storage_;
+	mutable std::mutex callback_mutex_;
+	callback on_changed_;
+	std::vector<std::function<void()>> observers_;
+	bool delta_updates_ = false;
+};
+
+// =============================================================================
+// Computed Property
+// =============================================================================
+
+/**
+ * Abgeleiteter Wert aus mehreren Input-Properties, z.B. eine Status-
+ * Zusammenfassung aus counter, status und numbers. Ohne diesen Typ baut
+ * die JS-Seite solche Ableitungen selbst: N Subscriptions, N Bridge-
+ * Notifications und N Recomputes pro Änderungs-Burst.
+ *
+ *   computed_property<std::string> summary{
+ *       [this] { return make_summary(); },
+ *       counter, status, numbers
+ *   };
+ *
+ * Eigenschaften:
+ *   - LAZY: Input-Änderungen setzen nur ein Dirty-Flag; gerechnet wird
+ *     erst beim nächsten get() bzw. zum Flush-Zeitpunkt des Coalescers.
+ *   - HÖCHSTENS EINMAL PRO FLUSH: die Bridge-Subscription registriert
+ *     bei der ersten Invalidierung eines Bursts EINE deferred
+ *     Auswertung beim Coalescer - egal wie viele Inputs sich bis zum
+ *     Flush noch ändern.
+ *   - NUR ECHTE ÄNDERUNGEN: liefert die Neuberechnung dasselbe Ergebnis
+ *     wie zuletzt gemeldet, geht keine Notification raus.
+ *
+ * Aus JS-Sicht ein ganz normales (read-only) Property; der Generator
+ * behandelt computed_property-Felder wie property-Felder. Inputs müssen
+ * im selben Objekt deklariert sein, und zwar VOR dem computed_property
+ * (Initialisierungsreihenfolge - der Konstruktor hängt sich an sie an).
+ */
+template<typename T>
+class computed_property {
+public:
+	using compute_fn = std::function<T()>;
+	using callback = std::function<void(const T&)>;
+
+	template<typename... Inputs>
+	explicit computed_property(compute_fn compute, property<Inputs>&... inputs)
+		: compute_(std::move(compute))
+	{
+		(inputs.add_observer([this]() { invalidate(); }), ...);
+	}
+
+	[[nodiscard]] T get() const {
+		std::lock_guard lock(mutex_);
+		refresh_locked();
+		return value_;
+	}
+
+	[[nodiscard]] T operator()() const {
+		return get();
+	}
+
+	void set_on_changed(callback callback) {
+		std::lock_guard lock(mutex_);
+		on_changed_ = std::move(callback);
+	}
+
+	/**
+	 * Bridge-Anbindung (siehe subscribe_property in binding_helpers.h):
+	 * der Scheduler wird bei der ERSTEN Invalidierung eines Bursts
+	 * gerufen und muss dafür sorgen, dass evaluate_and_notify() zum
+	 * Flush-Zeitpunkt läuft.
+	 */
+	void set_notify_scheduler(std::function<void()> scheduler) {
+		std::lock_guard lock(mutex_);
+		scheduler_ = std::move(scheduler);
+	}
+
+	/**
+	 * Läuft zum Flush-Zeitpunkt: einmal auswerten und den on_changed-
+	 * Callback nur feuern, wenn sich das Ergebnis gegenüber der letzten
+	 * Meldung tatsächlich geändert hat.
+	 */
+	void evaluate_and_notify() {
+		callback cb;
+		T changed{};
+		bool fire = false;
+		{
+			std::lock_guard lock(mutex_);
+			notify_pending_ = false;
+			refresh_locked();
+			if (!has_notified_ || !(value_ == notified_value_)) {
+				notified_value_ = value_;
+				has_notified_ = true;
+				changed = value_;
+				fire = true;
+				cb = on_changed_;
+			}
+		}
+		if (fire && cb) {
+			cb(changed);
+		}
+	}
+
+	computed_property(const computed_property&) = delete;
+	computed_property& operator=(const computed_property&) = delete;
+
+private:
+	void invalidate() {
+		std::function<void()> scheduler;
+		{
+			std::lock_guard lock(mutex_);
+			dirty_ = true;
+			if (notify_pending_ || !scheduler_) {
+				return;
+			}
+			notify_pending_ = true;
+			scheduler = scheduler_;
+		}
+		// Außerhalb des Locks: der Scheduler landet beim Coalescer, und
+		// dessen Flush ruft evaluate_and_notify() - das nimmt mutex_
+		scheduler();
+	}
+
+	// compute_ läuft unter mutex_; die Input-Reads nehmen nur deren
+	// eigene Storage-Locks, daher kein Zyklus
+	void refresh_locked() const {
+		if (dirty_) {
+			value_ = compute_();
+			dirty_ = false;
+		}
+	}
+
+	mutable std::mutex mutex_;
+	compute_fn compute_;
+	mutable T value_{};
+	mutable bool dirty_ = true;
+	T notified_value_{};
+	bool has_notified_ = false;
+	bool notify_pending_ = false;
 	callback on_changed_;
+	std::function<void()> scheduler_;
 };
 
 } // namespace webbridge::impl
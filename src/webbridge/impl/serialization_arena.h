@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * WebBridge Serialization Arena
+ *
+ * Die Notify-/Emit-Pfade bauen pro Flush einen Eval-String aus vielen
+ * kleinen Anhäng-Operationen zusammen. Ohne Wiederverwendung heißt das:
+ * wachsende Reallokationen pro Flush, bei unseren Notification-Raten
+ * konstante Allocator-Churn auf dem UI-Pfad.
+ *
+ * arena_buffer leiht sich einen thread-lokalen, wiederverwendeten
+ * std::string: die Kapazität vom letzten Flush bleibt erhalten, der
+ * eingeschwungene Zustand baut Eval-Strings komplett allokationsfrei.
+ * Thread-lokal, daher kein Lock - jeder Thread hat seinen eigenen
+ * kleinen Pool.
+ *
+ * Nur für transiente Strings verwenden (bauen, verschicken, fertig).
+ * Payloads, die eine Queue überleben müssen, brauchen weiterhin eigene
+ * Ownership.
+ */
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace webbridge::impl {
+
+namespace arena_detail {
+
+// Obergrenzen, damit ein einmaliger Riesen-Payload nicht dauerhaft
+// Speicher im Pool festhält
+constexpr size_t MAX_POOLED_BUFFERS = 4;
+constexpr size_t MAX_RETAINED_CAPACITY = 1 << 20;	// 1 MiB
+
+inline std::vector<std::string>& local_pool() {
+	thread_local std::vector<std::string> pool;
+	return pool;
+}
+
+} // namespace arena_detail
+
+/**
+ * RAII-Handle auf einen gepoolten String. Bei Zerstörung wandert der
+ * Buffer (samt Kapazität) zurück in den thread-lokalen Pool.
+ */
+class arena_buffer {
+public:
+	arena_buffer() {
+		auto& pool = arena_detail::local_pool();
+		if (!pool.empty()) {
+			m_str = std::move(pool.back());
+			pool.pop_back();
+			m_str.clear();
+		} else {
+			m_str.reserve(256);
+		}
+	}
+
+	~arena_buffer() {
+		auto& pool = arena_detail::local_pool();
+		if (pool.size() < arena_detail::MAX_POOLED_BUFFERS
+			&& m_str.capacity() <= arena_detail::MAX_RETAINED_CAPACITY) {
+			pool.push_back(std::move(m_str));
+		}
+	}
+
+	std::string& str() { return m_str; }
+	const std::string& str() const { return m_str; }
+
+	arena_buffer(const arena_buffer&) = delete;
+	arena_buffer& operator=(const arena_buffer&) = delete;
+
+private:
+	std::string m_str;
+};
+
+} // namespace webbridge::impl
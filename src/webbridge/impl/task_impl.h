@@ -0,0 +1,212 @@
+#pragma once
+
+/**
+ * WebBridge Coroutine Task
+ *
+ * webbridge::task<T> ist der Rückgabetyp für coroutine-basierte
+ * Async-Methoden. Eine Methode, die task<T> zurückgibt, läuft auf dem
+ * Pool-Worker nur bis zu ihrem ersten co_await und gibt den Thread dann
+ * frei - hunderte parallele I/O-Calls belegen so eine Handvoll Threads
+ * statt pro Call einen Worker für die volle Laufzeit zu blockieren.
+ *
+ * VERWENDUNG:
+ * -----------
+ *   [[async]] webbridge::task<std::string> readDevice(int channel) {
+ *       auto data = co_await m_socket.read(channel);  // Worker ist frei
+ *       co_return decode(data);
+ *   }
+ *
+ * Das generierte Binding erkennt den task<>-Rückgabetyp und resolved
+ * das JS-Promise erst, wenn die Coroutine fertig ist (co_return oder
+ * Exception). Der Aufruf aus JS sieht identisch aus wie bei normalen
+ * Async-Methoden.
+ *
+ * REGELN:
+ * -------
+ * - Parameter BY VALUE nehmen! Referenzparameter zeigen nach dem ersten
+ *   co_await auf längst zerstörte Temporaries.
+ * - Die Fortsetzung läuft auf dem Thread, der das Awaitable abschließt -
+ *   nicht zwingend auf einem Pool-Worker.
+ * - current_cancellation_token() ist thread-local und überlebt kein
+ *   co_await; Abbruchprüfungen vor der ersten Suspendierung erledigen
+ *   oder das Token vorher per Wert sichern.
+ *
+ * Lebensdauer: Start ist eager (initial_suspend = suspend_never), das
+ * Ergebnis landet in einem shared state außerhalb des Coroutine-Frames.
+ * Der Frame zerstört sich nach complete() selbst (final_suspend =
+ * suspend_never); task-Handles bleiben danach gültig.
+ */
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace webbridge::impl {
+
+namespace task_detail {
+
+// Completion state shared between the coroutine frame and all task
+// handles. The mutex also orders the value write (before done=true under
+// lock) against readers, so result() needs no extra synchronization.
+struct task_state_base {
+	mutable std::mutex mutex;
+	bool done = false;
+	std::exception_ptr error;
+	std::function<void()> continuation;
+
+	// Called from final_suspend: publishes the result and runs the
+	// continuation (outside the lock) if one is already attached.
+	void complete() {
+		std::function<void()> cont;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			done = true;
+			cont = std::move(continuation);
+		}
+		if (cont) {
+			cont();
+		}
+	}
+
+	// Attaches the continuation, or runs it inline when the coroutine
+	// already finished (lost the race).
+	void set_continuation(std::function<void()> cont) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!done) {
+				continuation = std::move(cont);
+				return;
+			}
+		}
+		cont();
+	}
+
+	bool is_done() const {
+		std::lock_guard<std::mutex> lock(mutex);
+		return done;
+	}
+};
+
+template<typename T>
+struct task_state : task_state_base {
+	std::optional<T> value;
+
+	T take() {
+		std::lock_guard<std::mutex> lock(mutex);
+		if (error) {
+			std::rethrow_exception(error);
+		}
+		return std::move(*value);
+	}
+};
+
+template<>
+struct task_state<void> : task_state_base {
+	void take() {
+		std::lock_guard<std::mutex> lock(mutex);
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+};
+
+} // namespace task_detail
+
+template<typename T = void>
+class task {
+public:
+	struct promise_type {
+		std::shared_ptr<task_detail::task_state<T>> state =
+			std::make_shared<task_detail::task_state<T>>();
+
+		task get_return_object() { return task(state); }
+
+		// Eager start: the body runs on the calling thread until its
+		// first co_await, then the caller gets its thread back.
+		std::suspend_never initial_suspend() noexcept { return {}; }
+
+		// complete() fires the continuation BEFORE the frame dies - the
+		// result already lives in the shared state at this point.
+		std::suspend_never final_suspend() noexcept {
+			state->complete();
+			return {};
+		}
+
+		void return_value(T v) { state->value = std::move(v); }
+		void unhandled_exception() { state->error = std::current_exception(); }
+	};
+
+	/** True sobald die Coroutine fertig ist (co_return oder Exception). */
+	bool done() const { return m_state->is_done(); }
+
+	/**
+	 * Registriert die Completion-Continuation (genau eine). Läuft sofort
+	 * inline, falls die Coroutine bereits fertig ist.
+	 */
+	void on_completed(std::function<void()> cont) {
+		m_state->set_continuation(std::move(cont));
+	}
+
+	/** Ergebnis abholen; wirft die in der Coroutine gefangene Exception. */
+	T result() { return m_state->take(); }
+
+	// task ist selbst awaitable: Coroutinen können Unter-Tasks
+	// per co_await verketten.
+	bool await_ready() const { return m_state->is_done(); }
+	void await_suspend(std::coroutine_handle<> h) {
+		m_state->set_continuation([h]() { h.resume(); });
+	}
+	T await_resume() { return m_state->take(); }
+
+private:
+	explicit task(std::shared_ptr<task_detail::task_state<T>> state)
+		: m_state(std::move(state)) {}
+
+	std::shared_ptr<task_detail::task_state<T>> m_state;
+};
+
+// void specialization: identical shape, but return_void instead of
+// return_value (the two cannot coexist in one promise_type).
+template<>
+class task<void> {
+public:
+	struct promise_type {
+		std::shared_ptr<task_detail::task_state<void>> state =
+			std::make_shared<task_detail::task_state<void>>();
+
+		task get_return_object() { return task(state); }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept {
+			state->complete();
+			return {};
+		}
+		void return_void() {}
+		void unhandled_exception() { state->error = std::current_exception(); }
+	};
+
+	bool done() const { return m_state->is_done(); }
+
+	void on_completed(std::function<void()> cont) {
+		m_state->set_continuation(std::move(cont));
+	}
+
+	void result() { m_state->take(); }
+
+	bool await_ready() const { return m_state->is_done(); }
+	void await_suspend(std::coroutine_handle<> h) {
+		m_state->set_continuation([h]() { h.resume(); });
+	}
+	void await_resume() { m_state->take(); }
+
+private:
+	explicit task(std::shared_ptr<task_detail::task_state<void>> state)
+		: m_state(std::move(state)) {}
+
+	std::shared_ptr<task_detail::task_state<void>> m_state;
+};
+
+} // namespace webbridge::impl
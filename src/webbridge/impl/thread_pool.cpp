@@ -25,5 +25,15 @@ thread_pool& get_thread_pool() {
     return pool;
 }
 
+// Hinweis: instanziiert den Pool (lazy) - daher NACH
+// set_thread_pool_size() aufrufen.
+void set_task_queue_limit(size_t capacity, queue_overflow_policy policy) {
+    get_thread_pool().set_queue_limit(capacity, policy);
+}
+
+void set_task_queue_watermark(size_t depth, std::function<void(size_t, bool)> callback) {
+    get_thread_pool().set_queue_watermark(depth, std::move(callback));
+}
+
 } // namespace impl
 } // namespace webbridge
@@ -2,46 +2,62 @@
 
 /**
  * WebBridge Thread Pool Configuration
- * 
+ *
  * Dieser Header ermöglicht die Konfiguration des Thread-Pools für Async-Calls.
- * 
+ *
  * VERWENDUNG:
  * -----------
  * Vor dem ersten WebBridge-Call (z.B. in main.cpp):
- * 
+ *
  *   #include "webbridge/impl/thread_pool.h"
- *   
+ *
  *   // Optional: Anzahl Worker-Threads setzen (Default: CPU-Kerne)
  *   webbridge::config::set_thread_pool_size(8);
- *   
+ *
  *   // Später: Thread-Pool holen
  *   auto& pool = webbridge::impl::get_thread_pool();
- * 
- * WAS PASSIERT BEI MEHR ANFRAGEN ALS THREADS?
- * -------------------------------------------
- * Der Thread-Pool verwendet eine Task-Queue (FIFO).
- * 
- * Beispiel: Pool mit 4 Threads, 10 gleichzeitige Async-Calls:
- * 
- *   1. Calls 1-4 werden sofort von den 4 Worker-Threads verarbeitet
- *   2. Calls 5-10 werden in die Queue eingereiht und warten
- *   3. Sobald Thread 1 fertig ist, nimmt er Call 5 aus der Queue
- *   4. Sobald Thread 2 fertig ist, nimmt er Call 6 aus der Queue
- *   ... und so weiter
- * 
+ *
+ * ARCHITEKTUR: WORK-STEALING
+ * --------------------------
+ * Früher teilten sich alle Worker EINE globale Queue hinter EINEM Mutex.
+ * Ab ~8 Threads wurde dieser eine Lock zum Flaschenhals: jede submit()-
+ * und jede pop()-Operation serialisierte sich auf demselben Mutex.
+ *
+ * Jetzt besitzt jeder Worker seine EIGENE Deque:
+ *
+ *   1. submit() verteilt Tasks round-robin auf die Worker-Deques
+ *   2. Jeder Worker nimmt Tasks vom EIGENEN Deque-Ende (LIFO, cache-warm)
+ *   3. Ist die eigene Deque leer, STIEHLT der Worker vom ANFANG
+ *      einer fremden Deque (FIFO, minimiert Konflikte mit dem Besitzer)
+ *
+ * Jede Deque hat ihren eigenen, fast immer unumkämpften Lock - Submit-
+ * und Pop-Pfade verschiedener Worker berühren sich nicht mehr und
+ * skalieren über die Kerne statt auf einem globalen Lock zu
+ * serialisieren.
+ *
  * VORTEILE gegenüber std::thread().detach():
  * ------------------------------------------
  * - Keine Thread-Erstellung pro Call (~50-100µs gespart pro Async-Call!)
  * - Begrenzte Thread-Anzahl verhindert Thread-Explosion
  * - Bessere CPU-Cache-Nutzung durch Thread-Wiederverwendung
  * - Kontrollierte Last auf dem System
- * 
+ *
+ * BACKPRESSURE / QUEUE-LIMIT:
+ * ---------------------------
+ * Ohne Limit wächst die Queue bei Überlast unbegrenzt - jede wartende
+ * Task hält ihre komplette Argument-Kopie im Speicher. Mit
+ * set_task_queue_limit() wird die Anzahl WARTENDER Tasks begrenzt;
+ * queue_overflow_policy bestimmt, was bei voller Queue passiert.
+ * Zusätzlich meldet eine optionale Hochwassermarke
+ * (set_task_queue_watermark), wenn sich die Queue füllt, damit die
+ * Anwendung frühzeitig drosseln kann.
+ *
  * NACHTEILE / TRADE-OFFS:
  * -----------------------
  * - Bei sehr langen Tasks können kurze Tasks blockiert werden
- * - Queue kann bei Überlast wachsen (Speicherverbrauch)
+ * - Ohne Queue-Limit kann die Queue bei Überlast wachsen (Default)
  * - Bei zu wenigen Threads: höhere Latenz unter Last
- * 
+ *
  * EMPFOHLENE POOL-GRÖSSEN:
  * ------------------------
  * - CPU-bound Tasks: std::thread::hardware_concurrency() (Default)
@@ -49,8 +65,10 @@
  * - Mixed Workload: hardware_concurrency() + 2
  */
 
+#include "trace.h"
+
 #include <functional>
-#include <queue>
+#include <deque>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
@@ -63,9 +81,44 @@ namespace webbridge::impl {
 void set_thread_pool_size(size_t num_threads);
 size_t get_thread_pool_size();
 
+/**
+ * Priority lanes for submitted tasks.
+ *
+ * high:       latency-sensitive calls (quick status queries). Checked
+ *             before the regular work-stealing deques.
+ * normal:     default - round-robin across the per-worker deques.
+ * background: long-running work (file exports). Only picked up when no
+ *             other work is available, so it cannot starve quick calls.
+ */
+enum class task_priority {
+    high,
+    normal,
+    background
+};
+
+/**
+ * Behavior when the bounded task queue is full (see set_task_queue_limit).
+ *
+ * reject:      submit() fails immediately; the JS Promise of the call
+ *              rejects with QUEUE_OVERLOADED.
+ * shed_oldest: the oldest queued normal/background task is dropped (its
+ *              Promise rejects) to make room for the new one. The high
+ *              lane is never shed.
+ * block:       submit() blocks the caller until a worker frees a slot.
+ *              VORSICHT: blockiert den aufrufenden (UI-)Thread!
+ */
+enum class queue_overflow_policy {
+    reject,
+    shed_oldest,
+    block
+};
+
+void set_task_queue_limit(size_t capacity, queue_overflow_policy policy);
+void set_task_queue_watermark(size_t depth, std::function<void(size_t, bool)> callback);
+
 
 // =============================================================================
-// Simple Thread Pool Implementation
+// Work-Stealing Thread Pool Implementation
 // =============================================================================
 
 class thread_pool {
@@ -75,93 +128,337 @@ public:
             num_threads = std::thread::hardware_concurrency();
             if (num_threads == 0) num_threads = 4; // Fallback
         }
-        
+
         m_stop = false;
+        m_queues.reserve(num_threads);
         m_workers.reserve(num_threads);
-        
+
+        for (size_t i = 0; i < num_threads; ++i) {
+            m_queues.emplace_back(std::make_unique<worker_queue>());
+        }
         for (size_t i = 0; i < num_threads; ++i) {
-            m_workers.emplace_back([this]() {
-                worker_loop();
+            m_workers.emplace_back([this, i]() {
+                worker_loop(i);
             });
         }
     }
-    
+
     ~thread_pool() {
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
+            std::unique_lock<std::mutex> lock(m_sleep_mutex);
             m_stop = true;
         }
         m_condition.notify_all();
-        
+        m_space_condition.notify_all();
+
         for (auto& worker : m_workers) {
             if (worker.joinable()) {
                 worker.join();
             }
         }
     }
-    
+
     // Non-copyable, non-movable
     thread_pool(const thread_pool&) = delete;
     thread_pool& operator=(const thread_pool&) = delete;
     thread_pool(thread_pool&&) = delete;
     thread_pool& operator=(thread_pool&&) = delete;
-    
+
     /**
      * Submit a task to the pool.
-     * The task will be executed by one of the worker threads.
-     * If all workers are busy, the task is queued (FIFO).
+     * Tasks are distributed round-robin across the per-worker deques;
+     * idle workers steal from busy ones, so a burst landing on one
+     * deque still spreads across all cores.
      */
     void submit(std::function<void()> task) {
+        submit(task_priority::normal, std::move(task));
+    }
+
+    /**
+     * Submit a task with an explicit priority lane.
+     * High-priority tasks are checked by every worker before its own
+     * deque; background tasks only run when nothing else is pending.
+     *
+     * When a queue limit is configured, a full queue is handled per the
+     * configured overflow policy. on_rejected is invoked (on the
+     * submitting thread) for every task that gets dropped - the new one
+     * under reject, the shed victim under shed_oldest. Returns false if
+     * THIS task was not enqueued.
+     */
+    bool submit(task_priority priority, std::function<void()> task,
+                std::function<void()> on_rejected = {}) {
+        const auto capacity = m_capacity.load(std::memory_order_relaxed);
+        if (capacity != 0 && !reserve_slot(capacity, on_rejected)) {
+            return false;
+        }
+
+        task_entry entry{std::move(task), std::move(on_rejected)};
+        // Counter BEFORE the task becomes visible: a worker that pops
+        // the entry right away must never fetch_sub past a fetch_add
+        // that has not happened yet (size_t underflow -> SIZE_MAX, and
+        // every counter-based decision misfires until it wraps back).
+        // A woken worker may briefly see the count without the task and
+        // spin once through its lanes - that is harmless.
+        const auto depth = m_pending.fetch_add(1, std::memory_order_release) + 1;
+        if (priority == task_priority::normal) {
+            auto index = m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+            std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+            m_queues[index]->tasks.push_back(std::move(entry));
+        } else {
+            auto& lane = (priority == task_priority::high) ? m_high : m_background;
+            std::lock_guard<std::mutex> lock(lane.mutex);
+            lane.tasks.push_back(std::move(entry));
+        }
+        check_watermark_rising(depth);
+        // Taking m_sleep_mutex (even empty) before notifying closes the
+        // lost-wakeup window: a worker whose wait predicate ran before
+        // our fetch_add is guaranteed to be fully blocked - and thus
+        // reachable by the notify - once we hold the lock, because
+        // wait() releases the mutex only as it blocks.
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_tasks.push(std::move(task));
+            std::lock_guard<std::mutex> sleep_lock(m_sleep_mutex);
         }
         m_condition.notify_one();
+        return true;
     }
-    
+
+    /**
+     * Bounds the number of QUEUED (not running) tasks.
+     * capacity 0 removes the limit again (default). Can be changed at
+     * runtime; tasks already queued beyond a new, lower limit stay
+     * queued and simply drain.
+     */
+    void set_queue_limit(size_t capacity, queue_overflow_policy policy) {
+        m_policy.store(policy, std::memory_order_relaxed);
+        m_capacity.store(capacity, std::memory_order_relaxed);
+        if (capacity == 0) {
+            // Same lost-wakeup bridge as submit(): a block-policy waiter
+            // whose predicate ran before the store must be fully blocked
+            // before the notify fires.
+            {
+                std::lock_guard<std::mutex> sleep_lock(m_sleep_mutex);
+            }
+            m_space_condition.notify_all();
+        }
+    }
+
+    /**
+     * Queue-depth watermark: callback(depth, true) fires once when the
+     * queue grows past depth, callback(depth, false) once it has
+     * drained back below depth/2 (hysteresis, avoids flapping).
+     * Runs on whatever thread crosses the mark - keep it cheap.
+     * Must be set before the first async call.
+     */
+    void set_queue_watermark(size_t depth, std::function<void(size_t, bool)> callback) {
+        // Callback first: submit() only looks at it once m_watermark is set
+        m_watermark_callback = std::move(callback);
+        m_watermark.store(depth, std::memory_order_release);
+    }
+
     /**
      * Returns the number of worker threads.
      */
     size_t size() const {
         return m_workers.size();
     }
-    
+
     /**
-     * Returns the approximate number of pending tasks in the queue.
+     * Returns the approximate number of pending tasks across all deques.
      */
     size_t pending() const {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        return m_tasks.size();
+        return m_pending.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Returns the number of workers currently EXECUTING a task (not
+     * sleeping, not stealing). Momentary sample for the metrics
+     * dashboard: active() / size() is the worker utilization.
+     */
+    size_t active() const {
+        return m_active.load(std::memory_order_relaxed);
     }
 
 private:
-    void worker_loop() {
+    // A queued task plus its rejection handler (invoked when the task
+    // is dropped by the overflow policy instead of being run).
+    struct task_entry {
+        std::function<void()> run;
+        std::function<void()> on_rejected;
+    };
+
+    struct worker_queue {
+        std::deque<task_entry> tasks;
+        std::mutex mutex;
+    };
+
+    void worker_loop(size_t index) {
         while (true) {
-            std::function<void()> task;
-            
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
+            task_entry entry;
+
+            // Lane order: high -> own deque -> steal -> background
+            if (!try_pop_lane(m_high, entry)
+                && !try_pop_local(index, entry)
+                && !try_steal(index, entry)
+                && !try_pop_lane(m_background, entry)) {
+                std::unique_lock<std::mutex> lock(m_sleep_mutex);
                 m_condition.wait(lock, [this]() {
-                    return m_stop || !m_tasks.empty();
+                    return m_stop || m_pending.load(std::memory_order_acquire) > 0;
                 });
-                
-                if (m_stop && m_tasks.empty()) {
+
+                if (m_stop && m_pending.load(std::memory_order_acquire) == 0) {
                     return;
                 }
-                
-                task = std::move(m_tasks.front());
-                m_tasks.pop();
+                continue;
+            }
+
+            const auto depth = m_pending.fetch_sub(1, std::memory_order_release) - 1;
+            if (m_capacity.load(std::memory_order_relaxed) != 0) {
+                // Bridge the race against a block-policy submitter whose
+                // wait predicate ran before our fetch_sub (see submit()).
+                {
+                    std::lock_guard<std::mutex> sleep_lock(m_sleep_mutex);
+                }
+                m_space_condition.notify_one();
+            }
+            check_watermark_falling(depth);
+
+            // Execute task outside any lock
+            m_active.fetch_add(1, std::memory_order_relaxed);
+            {
+                trace_span span("pool", "task");
+                entry.run();
+            }
+            m_active.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Enforces the queue bound according to the overflow policy.
+    // Returns true if the caller may enqueue its task.
+    bool reserve_slot(size_t capacity, const std::function<void()>& on_rejected) {
+        switch (m_policy.load(std::memory_order_relaxed)) {
+        case queue_overflow_policy::reject:
+            if (m_pending.load(std::memory_order_acquire) >= capacity) {
+                if (on_rejected) on_rejected();
+                return false;
+            }
+            return true;
+
+        case queue_overflow_policy::shed_oldest:
+            while (m_pending.load(std::memory_order_acquire) >= capacity) {
+                task_entry victim;
+                if (!try_shed(victim)) {
+                    break; // everything already in-flight, nothing left to shed
+                }
+                m_pending.fetch_sub(1, std::memory_order_release);
+                if (victim.on_rejected) victim.on_rejected();
             }
-            
-            // Execute task outside the lock
-            task();
+            return true;
+
+        case queue_overflow_policy::block: {
+            std::unique_lock<std::mutex> lock(m_sleep_mutex);
+            m_space_condition.wait(lock, [this, capacity]() {
+                return m_stop
+                    || m_capacity.load(std::memory_order_relaxed) == 0
+                    || m_pending.load(std::memory_order_acquire) < capacity;
+            });
+            if (m_stop) {
+                if (on_rejected) on_rejected();
+                return false;
+            }
+            return true;
         }
+        }
+        return true;
     }
-    
+
+    // Shed victim order: background lane first, then the oldest task
+    // of the normal deques. The high lane is deliberately never shed.
+    bool try_shed(task_entry& victim) {
+        if (try_pop_lane(m_background, victim)) {
+            return true;
+        }
+        for (auto& queue : m_queues) {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            if (!queue->tasks.empty()) {
+                victim = std::move(queue->tasks.front());
+                queue->tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void check_watermark_rising(size_t depth) {
+        const auto mark = m_watermark.load(std::memory_order_acquire);
+        if (mark != 0 && depth >= mark
+            && !m_above_watermark.exchange(true, std::memory_order_acq_rel)) {
+            m_watermark_callback(depth, true);
+        }
+    }
+
+    void check_watermark_falling(size_t depth) {
+        const auto mark = m_watermark.load(std::memory_order_acquire);
+        if (mark != 0 && depth <= mark / 2
+            && m_above_watermark.exchange(false, std::memory_order_acq_rel)) {
+            m_watermark_callback(depth, false);
+        }
+    }
+
+    bool try_pop_lane(worker_queue& lane, task_entry& entry) {
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        if (lane.tasks.empty()) {
+            return false;
+        }
+        entry = std::move(lane.tasks.front());
+        lane.tasks.pop_front();
+        return true;
+    }
+
+    // Own deque: pop from the back (LIFO) - the most recently pushed
+    // task is the most likely to still be cache-warm.
+    bool try_pop_local(size_t index, task_entry& entry) {
+        auto& queue = *m_queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        entry = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    // Foreign deques: steal from the front (FIFO) - the opposite end
+    // from the owner, so owner and thief rarely touch the same task.
+    bool try_steal(size_t index, task_entry& entry) {
+        const auto count = m_queues.size();
+        for (size_t offset = 1; offset < count; ++offset) {
+            auto& queue = *m_queues[(index + offset) % count];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            entry = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    std::vector<std::unique_ptr<worker_queue>> m_queues;
+    worker_queue m_high;
+    worker_queue m_background;
     std::vector<std::thread> m_workers;
-    std::queue<std::function<void()>> m_tasks;
-    mutable std::mutex m_mutex;
+    std::atomic<size_t> m_next_queue{0};
+    std::atomic<size_t> m_pending{0};
+    std::atomic<size_t> m_active{0};
+    std::atomic<size_t> m_capacity{0}; // 0 = unbounded
+    std::atomic<queue_overflow_policy> m_policy{queue_overflow_policy::reject};
+    std::atomic<size_t> m_watermark{0}; // 0 = no watermark
+    std::atomic<bool> m_above_watermark{false};
+    std::function<void(size_t, bool)> m_watermark_callback;
+    mutable std::mutex m_sleep_mutex;
     std::condition_variable m_condition;
+    std::condition_variable m_space_condition;
     bool m_stop;
 };
 
@@ -0,0 +1,134 @@
+#include "trace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace webbridge::impl {
+
+std::atomic<bool> g_trace_enabled{false};
+
+namespace {
+
+struct trace_event {
+	const char* category;
+	std::string name;
+	int64_t start_us;
+	int64_t duration_us;
+	uint32_t tid;
+};
+
+// Per-Thread-Buffer. Der Mutex ist im Normalfall unumkämpft (nur der
+// eigene Thread schreibt) - er existiert nur, damit trace_stop() die
+// Buffer fremder Threads konsistent auslesen kann.
+struct thread_buffer {
+	std::mutex mutex;
+	std::vector<trace_event> events;
+	uint32_t tid;
+};
+
+std::mutex g_registry_mutex;
+std::vector<thread_buffer*> g_buffers;
+std::string g_output_path;
+std::atomic<uint32_t> g_next_tid{1};
+
+thread_buffer& local_buffer() {
+	// Buffer leben bis Prozessende - Threads können vor trace_stop()
+	// beendet werden, ihre Events dürfen dabei nicht verloren gehen.
+	thread_local thread_buffer* buffer = [] {
+		auto* b = new thread_buffer();
+		b->tid = g_next_tid.fetch_add(1, std::memory_order_relaxed);
+		b->events.reserve(4096);
+		std::lock_guard lock(g_registry_mutex);
+		g_buffers.push_back(b);
+		return b;
+	}();
+	return *buffer;
+}
+
+const auto g_process_start = std::chrono::steady_clock::now();
+
+void write_json_escaped(std::ofstream& out, const std::string& text) {
+	for (char c : text) {
+		switch (c) {
+			case '"':  out << "\\\""; break;
+			case '\\': out << "\\\\"; break;
+			case '\n': out << "\\n"; break;
+			case '\t': out << "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20) {
+					char buf[8];
+					std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+					out << buf;
+				} else {
+					out << c;
+				}
+		}
+	}
+}
+
+} // namespace
+
+int64_t trace_now_us() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - g_process_start).count();
+}
+
+void trace_record(const char* category, std::string name,
+	int64_t start_us, int64_t duration_us)
+{
+	auto& buffer = local_buffer();
+	std::lock_guard lock(buffer.mutex);
+	buffer.events.push_back({category, std::move(name), start_us, duration_us, buffer.tid});
+}
+
+void trace_start(const std::string& output_path) {
+	{
+		std::lock_guard lock(g_registry_mutex);
+		g_output_path = output_path;
+		for (auto* buffer : g_buffers) {
+			std::lock_guard buffer_lock(buffer->mutex);
+			buffer->events.clear();
+		}
+	}
+	g_trace_enabled.store(true, std::memory_order_release);
+}
+
+void trace_stop() {
+	if (!g_trace_enabled.exchange(false, std::memory_order_acq_rel)) {
+		return;
+	}
+
+	std::lock_guard lock(g_registry_mutex);
+	std::ofstream out(g_output_path, std::ios::trunc);
+	if (!out) {
+		return;
+	}
+
+	// Trace Event Format: https://chromium.googlesource.com/catapult -
+	// ein flaches Array von "complete"-Events reicht chrome://tracing.
+	out << "[";
+	bool first = true;
+	for (auto* buffer : g_buffers) {
+		std::lock_guard buffer_lock(buffer->mutex);
+		for (const auto& event : buffer->events) {
+			if (!first) {
+				out << ",";
+			}
+			first = false;
+			out << "\n{\"name\":\"";
+			write_json_escaped(out, event.name);
+			out << "\",\"cat\":\"" << event.category
+				<< "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.tid
+				<< ",\"ts\":" << event.start_us
+				<< ",\"dur\":" << event.duration_us << "}";
+		}
+		buffer->events.clear();
+	}
+	out << "\n]\n";
+}
+
+} // namespace webbridge::impl
@@ -0,0 +1,106 @@
+#pragma once
+
+/**
+ * WebBridge Tracing
+ *
+ * Span-basierte Instrumentierung für die Bridge-Hot-Paths (Dispatch,
+ * Thread-Pool, Property-Notifications). Ersetzt die alte
+ * timing_trace.log-cout-Umleitung aus main.cpp.
+ *
+ * Design:
+ *   - Events landen in per-Thread-Buffern; der Schreibpfad nimmt nur
+ *     den (unumkämpften) Buffer-Mutex des eigenen Threads - kein
+ *     globaler Lock, keine Formatierung, kein I/O auf dem Hot-Path.
+ *   - Deaktiviert kostet ein Span genau einen relaxed atomic load,
+ *     daher bleibt die Instrumentierung auch in Release-Builds drin.
+ *   - stop_tracing() schreibt alle Buffer als chrome://tracing-
+ *     kompatibles JSON ("Trace Event Format", ph:"X" complete events).
+ *     Die Datei lässt sich direkt in chrome://tracing oder Perfetto
+ *     laden, um langsame UI-Interaktionen mit ihren C++-Handlern zu
+ *     korrelieren.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace webbridge::impl {
+
+// Global an/aus - der einzige Check auf dem Hot-Path
+extern std::atomic<bool> g_trace_enabled;
+
+inline bool trace_enabled() {
+	return g_trace_enabled.load(std::memory_order_relaxed);
+}
+
+// Startet das Tracing; Events werden gesammelt, bis trace_stop()
+// sie nach output_path schreibt. Nicht reentrant.
+void trace_start(const std::string& output_path);
+
+// Stoppt das Tracing und schreibt die gesammelten Events als
+// Trace-Event-Format-JSON. No-op wenn Tracing nicht läuft.
+void trace_stop();
+
+// Interner Schreibpfad - nur über trace_span benutzen.
+void trace_record(const char* category, std::string name,
+	int64_t start_us, int64_t duration_us);
+
+// Aktueller Zeitstempel in µs seit Prozessstart (steady clock)
+int64_t trace_now_us();
+
+/**
+ * RAII-Span: misst von Konstruktion bis Destruktion.
+ *
+ *   trace_span span("dispatch", "MyObject.calculateAsync");
+ *
+ * category muss ein String-Literal sein (wird nicht kopiert). Für
+ * dynamische Namen die Lambda-Überladung verwenden - dann fällt die
+ * String-Konstruktion nur an, wenn Tracing tatsächlich läuft:
+ *
+ *   trace_span span("dispatch", [&] { return class_name + "." + member; });
+ */
+class trace_span {
+public:
+	trace_span(const char* category, std::string name)
+		: m_active(trace_enabled())
+	{
+		if (m_active) {
+			m_category = category;
+			m_name = std::move(name);
+			m_start_us = trace_now_us();
+		}
+	}
+
+	// Lazy-Name-Variante: name_fn wird nur bei aktivem Tracing gerufen
+	template<typename NameFn>
+		requires std::is_invocable_r_v<std::string, NameFn>
+	trace_span(const char* category, NameFn&& name_fn)
+		: m_active(trace_enabled())
+	{
+		if (m_active) {
+			m_category = category;
+			m_name = name_fn();
+			m_start_us = trace_now_us();
+		}
+	}
+
+	~trace_span() {
+		if (m_active) {
+			trace_record(m_category, std::move(m_name), m_start_us,
+				trace_now_us() - m_start_us);
+		}
+	}
+
+	trace_span(const trace_span&) = delete;
+	trace_span& operator=(const trace_span&) = delete;
+
+private:
+	bool m_active;
+	const char* m_category = nullptr;
+	std::string m_name;
+	int64_t m_start_us = 0;
+};
+
+} // namespace webbridge::impl
@@ -1,15 +1,19 @@
 #include "type_registration.h"
 #include "object_registry.h"
+#include "bridge_context.h"
 #include "thread_pool.h"
+#include "wire_protocol.h"
+#include "serialization_arena.h"
+#include "cancellation.h"
+#include "trace.h"
+#include "metrics.h"
+#include "fast_parse.h"
+#include "../error.h"
 #include <format>
-#include <unordered_set>
 #include <iostream>
 
 namespace webbridge::impl {
 
-// Track which webviews have been initialized
-static std::unordered_set<webview::webview*> initialized_webviews;
-
 // JavaScript runtime code - injected directly into webview
 // OPTIMIZED: Uses universal dispatcher functions instead of per-class bindings
 static constexpr const char* WEBBRIDGE_RUNTIME_JS = R"JS(
@@ -17,12 +21,17 @@ static constexpr const char* WEBBRIDGE_RUNTIME_JS = R"JS(
 // V8-Optimized: Monomorphic shapes, cached lookups, inline-friendly
 // DISPATCHER VERSION: Uses 4 universal bindings instead of 3*N per class
 
-// Object registry: objectId -> object instance
+// Object registry: objectId -> WeakRef(object instance). Weak so that
+// proxies dropped by application code become collectable - the GC
+// reclamation path below releases their C++ side automatically.
 const __webbridge_objects = {};
 
 // Class metadata registry: className -> config
 const __webbridge_class_configs = {};
 
+// Sequence for async call ids (used for cancellation)
+let __webbridge_callSeq = 0;
+
 // =============================================================================
 // Universal Dispatcher Functions (bound once, used by all classes)
 // =============================================================================
@@ -30,15 +39,52 @@ const __webbridge_class_configs = {};
 // These are bound by C++ init_webview() - called for ALL classes
 // window.__webbridge_create(className, ...args) -> objectId
 // window.__webbridge_sync(className, objectId, op, member, ...args) -> result
+// window.__webbridge_batch(calls) -> [[status, value], ...] (see pipelining below)
 // window.__webbridge_async(className, objectId, method, ...args) -> Promise
 // window.__webbridge_destroy(objectId) -> void
+// window.__webbridge_destroy_batch([objectId, ...]) -> void
+
+// =============================================================================
+// Automatic reclamation (GC-integrated)
+// =============================================================================
+
+// Safety net for proxies that were never destroy()ed: the registry above
+// only holds WeakRefs, so a dropped proxy gets collected eventually and
+// the FinalizationRegistry queues its id. Ids are released C++-side in
+// BATCHES - finalization callbacks arrive in GC bursts, and a short
+// timeout lets one __webbridge_destroy_batch crossing carry the whole
+// burst. Explicit destroy() stays the deterministic path and unregisters
+// itself here so an id is never released twice.
+
+let __webbridge_reclaimQueue = [];
+let __webbridge_reclaimScheduled = false;
+
+function __webbridge_flushReclaim() {
+    __webbridge_reclaimScheduled = false;
+    if (__webbridge_reclaimQueue.length === 0) {
+        return;
+    }
+    const ids = __webbridge_reclaimQueue;
+    __webbridge_reclaimQueue = [];
+    window.__webbridge_destroy_batch(ids);
+}
+
+const __webbridge_finalizers = new FinalizationRegistry((objectId) => {
+    delete __webbridge_objects[objectId];
+    __webbridge_reclaimQueue.push(objectId);
+    if (!__webbridge_reclaimScheduled) {
+        __webbridge_reclaimScheduled = true;
+        setTimeout(__webbridge_flushReclaim, 100);
+    }
+});
 
 // =============================================================================
 // C++ -> JS Handlers (called by C++ via webview eval)
 // =============================================================================
 
 window.__webbridge_notify = (objectId, propName, value) => {
-    const obj = __webbridge_objects[objectId];
+    const ref = __webbridge_objects[objectId];
+    const obj = ref && ref.deref();
     if (obj) {
         const prop = obj[propName];
         if (prop && prop._notify) {
@@ -47,8 +93,18 @@ window.__webbridge_notify = (objectId, propName, value) => {
     }
 };
 
+// Batched form: one eval delivers all property changes of a flush cycle.
+// entries: [[objectId, propName, value], ...]
+window.__webbridge_notify_batch = (entries) => {
+    for (let i = 0; i < entries.length; i++) {
+        const entry = entries[i];
+        window.__webbridge_notify(entry[0], entry[1], entry[2]);
+    }
+};
+
 window.__webbridge_emit = (objectId, eventName, ...args) => {
-    const obj = __webbridge_objects[objectId];
+    const ref = __webbridge_objects[objectId];
+    const obj = ref && ref.deref();
     if (obj) {
         const evt = obj[eventName];
         if (evt && evt._dispatch) {
@@ -57,15 +113,348 @@ window.__webbridge_emit = (objectId, eventName, ...args) => {
     }
 };
 
+// Batched form used by the C++ event channel drainer.
+// entries: [[objectId, eventName, [args...]], ...]
+window.__webbridge_emit_batch = (entries) => {
+    for (let i = 0; i < entries.length; i++) {
+        const entry = entries[i];
+        window.__webbridge_emit(entry[0], entry[1], ...entry[2]);
+    }
+};
+
+// =============================================================================
+// Binary Wire Protocol (CBOR envelopes, opt-in per class)
+// =============================================================================
+
+// Large payloads travel as {"$cbor": "<base64>"} envelopes instead of JSON
+// text (see impl/wire_protocol.h). Small calls keep the plain JSON path.
+
+function __webbridge_b64decode(str) {
+    const bin = atob(str);
+    const bytes = new Uint8Array(bin.length);
+    for (let i = 0; i < bin.length; i++) {
+        bytes[i] = bin.charCodeAt(i);
+    }
+    return bytes;
+}
+
+function __webbridge_b64encode(bytes) {
+    let bin = '';
+    const chunk = 0x8000;
+    for (let i = 0; i < bytes.length; i += chunk) {
+        bin += String.fromCharCode.apply(null, bytes.subarray(i, i + chunk));
+    }
+    return btoa(bin);
+}
+
+function __webbridge_cbor_decode(bytes) {
+    const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+    let pos = 0;
+    const textDecoder = new TextDecoder();
+
+    function readLength(info) {
+        if (info < 24) return info;
+        if (info === 24) { const v = view.getUint8(pos); pos += 1; return v; }
+        if (info === 25) { const v = view.getUint16(pos); pos += 2; return v; }
+        if (info === 26) { const v = view.getUint32(pos); pos += 4; return v; }
+        if (info === 27) {
+            const hi = view.getUint32(pos);
+            const lo = view.getUint32(pos + 4);
+            pos += 8;
+            return hi * 0x100000000 + lo;
+        }
+        throw new Error('CBOR: unsupported length encoding ' + info);
+    }
+
+    function decodeItem() {
+        const initial = view.getUint8(pos);
+        pos += 1;
+        const major = initial >> 5;
+        const info = initial & 0x1f;
+
+        switch (major) {
+            case 0: return readLength(info);
+            case 1: return -1 - readLength(info);
+            case 2: {
+                const len = readLength(info);
+                const slice = bytes.subarray(pos, pos + len);
+                pos += len;
+                return slice;
+            }
+            case 3: {
+                const len = readLength(info);
+                const slice = bytes.subarray(pos, pos + len);
+                pos += len;
+                return textDecoder.decode(slice);
+            }
+            case 4: {
+                const len = readLength(info);
+                const arr = new Array(len);
+                for (let i = 0; i < len; i++) arr[i] = decodeItem();
+                return arr;
+            }
+            case 5: {
+                const len = readLength(info);
+                const obj = {};
+                for (let i = 0; i < len; i++) {
+                    const key = decodeItem();
+                    obj[key] = decodeItem();
+                }
+                return obj;
+            }
+            case 7: {
+                if (info === 20) return false;
+                if (info === 21) return true;
+                if (info === 22 || info === 23) return null;
+                if (info === 26) { const v = view.getFloat32(pos); pos += 4; return v; }
+                if (info === 27) { const v = view.getFloat64(pos); pos += 8; return v; }
+                throw new Error('CBOR: unsupported simple value ' + info);
+            }
+            default:
+                throw new Error('CBOR: unsupported major type ' + major);
+        }
+    }
+
+    return decodeItem();
+}
+
+function __webbridge_cbor_encode(value) {
+    const chunks = [];
+    const textEncoder = new TextEncoder();
+
+    function pushHeader(major, length) {
+        if (length < 24) {
+            chunks.push(new Uint8Array([(major << 5) | length]));
+        } else if (length < 0x100) {
+            chunks.push(new Uint8Array([(major << 5) | 24, length]));
+        } else if (length < 0x10000) {
+            chunks.push(new Uint8Array([(major << 5) | 25, length >> 8, length & 0xff]));
+        } else {
+            const buf = new Uint8Array(5);
+            buf[0] = (major << 5) | 26;
+            new DataView(buf.buffer).setUint32(1, length);
+            chunks.push(buf);
+        }
+    }
+
+    function encodeItem(v) {
+        if (v === null || v === undefined) {
+            chunks.push(new Uint8Array([0xf6]));
+        } else if (v === true) {
+            chunks.push(new Uint8Array([0xf5]));
+        } else if (v === false) {
+            chunks.push(new Uint8Array([0xf4]));
+        } else if (typeof v === 'number') {
+            if (Number.isInteger(v) && Math.abs(v) <= 0xffffffff) {
+                if (v >= 0) pushHeader(0, v);
+                else pushHeader(1, -1 - v);
+            } else {
+                const buf = new Uint8Array(9);
+                buf[0] = 0xfb;
+                new DataView(buf.buffer).setFloat64(1, v);
+                chunks.push(buf);
+            }
+        } else if (typeof v === 'string') {
+            const encoded = textEncoder.encode(v);
+            pushHeader(3, encoded.length);
+            chunks.push(encoded);
+        } else if (Array.isArray(v)) {
+            pushHeader(4, v.length);
+            for (const item of v) encodeItem(item);
+        } else {
+            const keys = Object.keys(v);
+            pushHeader(5, keys.length);
+            for (const key of keys) {
+                encodeItem(key);
+                encodeItem(v[key]);
+            }
+        }
+    }
+
+    encodeItem(value);
+
+    let total = 0;
+    for (const c of chunks) total += c.length;
+    const out = new Uint8Array(total);
+    let offset = 0;
+    for (const c of chunks) {
+        out.set(c, offset);
+        offset += c.length;
+    }
+    return out;
+}
+
+// =============================================================================
+// TypedArray Marshalling (numeric containers as raw little-endian bytes)
+// =============================================================================
+
+// vector<int> & co. arrive as {"$typed": {t, b}} envelopes and surface
+// as typed views (Int32Array, Float64Array, ...) - no per-element JSON
+// parsing and no doubled memory for large waveform buffers.
+const __webbridge_typedCtors = {
+    i8: Int8Array, u8: Uint8Array,
+    i16: Int16Array, u16: Uint16Array,
+    i32: Int32Array, u32: Uint32Array,
+    f32: Float32Array, f64: Float64Array
+};
+
+function __webbridge_typed_decode(t) {
+    const bytes = __webbridge_b64decode(t.b);
+    const ctor = __webbridge_typedCtors[t.t];
+    // b64decode returns a fresh, aligned buffer - view it directly
+    return ctor ? new ctor(bytes.buffer) : bytes;
+}
+
+function __webbridge_typedTag(v) {
+    if (v instanceof Float64Array) return 'f64';
+    if (v instanceof Int32Array) return 'i32';
+    if (v instanceof Float32Array) return 'f32';
+    if (v instanceof Uint32Array) return 'u32';
+    if (v instanceof Int16Array) return 'i16';
+    if (v instanceof Uint16Array) return 'u16';
+    if (v instanceof Int8Array) return 'i8';
+    if (v instanceof Uint8Array) return 'u8';
+    return null;
+}
+
+// Typed views passed as arguments travel as raw bytes too; the C++
+// dispatcher expands the envelope before the generated handlers run.
+function __webbridge_maybeEncodeTyped(v) {
+    const t = __webbridge_typedTag(v);
+    if (t === null) return v;
+    return { $typed: { t: t, b: __webbridge_b64encode(
+        new Uint8Array(v.buffer, v.byteOffset, v.byteLength)) } };
+}
+
+// Unwraps wire envelopes; passes everything else through.
+// {"$cbor": ...} and {"$typed": ...} decode synchronously; {"$blob": url}
+// returns a Promise that fetches the bytes out-of-band as an ArrayBuffer.
+function __webbridge_decodeWire(v) {
+    if (v !== null && typeof v === 'object') {
+        if (typeof v.$cbor === 'string') {
+            return __webbridge_cbor_decode(__webbridge_b64decode(v.$cbor));
+        }
+        if (v.$typed && typeof v.$typed.b === 'string') {
+            return __webbridge_typed_decode(v.$typed);
+        }
+        if (typeof v.$blob === 'string') {
+            return fetch(v.$blob)
+                .then((r) => r.arrayBuffer())
+                .then((buf) => __webbridge_cbor_decode(new Uint8Array(buf)));
+        }
+    }
+    return v;
+}
+
+// Wraps an argument in a CBOR envelope when the class opted into binary
+// mode and the payload is large enough to benefit.
+function __webbridge_maybeEncodeWire(v, threshold) {
+    if (threshold > 0 && v !== null && typeof v === 'object') {
+        if (JSON.stringify(v).length >= threshold) {
+            return { $cbor: __webbridge_b64encode(__webbridge_cbor_encode(v)) };
+        }
+    }
+    return v;
+}
+
+// =============================================================================
+// Call pipelining (micro-batching)
+// =============================================================================
+
+// A sync bridge crossing costs its fixed WebView overhead regardless of
+// payload (doc/performance.md: ~243us, dominated by bridging, not JSON).
+// Bursts - a dashboard refresh firing dozens of small calls - pay it
+// once instead: all sync dispatches issued within the same microtask are
+// collected and shipped as a single __webbridge_batch crossing; the
+// response fans back out to the individual Promises in request order.
+let __webbridge_pendingBatch = null;
+
+function __webbridge_flushBatch() {
+    const batch = __webbridge_pendingBatch;
+    __webbridge_pendingBatch = null;
+    if (batch.length === 1) {
+        // Lone call in the window - skip the envelope
+        const entry = batch[0];
+        window.__webbridge_sync(...entry.args).then(entry.resolve, entry.reject);
+        return;
+    }
+    window.__webbridge_batch(batch.map((e) => e.args)).then((results) => {
+        for (let i = 0; i < batch.length; i++) {
+            if (results[i][0] === 0) {
+                batch[i].resolve(results[i][1]);
+            } else {
+                batch[i].reject(results[i][1]);
+            }
+        }
+    }, (err) => {
+        // Whole envelope failed - reject every rider
+        for (const entry of batch) {
+            entry.reject(err);
+        }
+    });
+}
+
+function __webbridge_syncBatched(...args) {
+    if (__webbridge_pendingBatch === null) {
+        __webbridge_pendingBatch = [];
+        queueMicrotask(__webbridge_flushBatch);
+    }
+    const batch = __webbridge_pendingBatch;
+    return new Promise((resolve, reject) => {
+        batch.push({ args: args, resolve: resolve, reject: reject });
+    });
+}
+
+// =============================================================================
+// Delta property updates (RFC 6902 JSON Patch, applied in place)
+// =============================================================================
+
+// Applies the patch ops the C++ side ships for delta-enabled properties.
+// nlohmann's json::diff only emits add/remove/replace, so exactly that
+// subset is handled here. Mutates target in place - update cost stays
+// proportional to the change, not the container size.
+function __webbridge_applyPatch(target, ops) {
+    for (const op of ops) {
+        if (op.path === '') {
+            // Whole-document replace (value changed type)
+            target = op.value;
+            continue;
+        }
+        const keys = op.path.split('/').slice(1)
+            .map((k) => k.replace(/~1/g, '/').replace(/~0/g, '~'));
+        let parent = target;
+        for (let i = 0; i < keys.length - 1; i++) {
+            parent = parent[keys[i]];
+        }
+        const key = keys[keys.length - 1];
+        if (Array.isArray(parent)) {
+            const index = key === '-' ? parent.length : parseInt(key, 10);
+            if (op.op === 'add') {
+                parent.splice(index, 0, op.value);
+            } else if (op.op === 'remove') {
+                parent.splice(index, 1);
+            } else {
+                parent[index] = op.value;
+            }
+        } else if (op.op === 'remove') {
+            delete parent[key];
+        } else {
+            parent[key] = op.value;
+        }
+    }
+    return target;
+}
+
 // =============================================================================
 // Property: Svelte-compatible store (V8-optimized)
 // =============================================================================
 
 class PropertyStore {
-    constructor(objectId, className, propName) {
+    constructor(objectId, classId, propName, propIdx) {
         this.objectId = objectId;
-        this.className = className;
+        this.classId = classId;
         this.propName = propName;
+        this.propIdx = propIdx;
         this.subscribers = new Set();
         this.currentValue = undefined;
         this.loaded = false;
@@ -76,8 +465,9 @@ class PropertyStore {
         if (this.loaded) {
             callback(this.currentValue);
         } else {
-            // Use universal sync dispatcher
-            window.__webbridge_sync(this.className, this.objectId, "prop", this.propName).then((v) => {
+            // Use universal sync dispatcher (interned ids: op 0 = prop);
+            // reads issued in the same microtask share one crossing
+            __webbridge_syncBatched(this.classId, this.objectId, 0, this.propIdx).then(__webbridge_decodeWire).then((v) => {
                 this.currentValue = v;
                 this.loaded = true;
                 callback(v);
@@ -89,13 +479,40 @@ class PropertyStore {
 
     async get() {
         if (!this.loaded) {
-            this.currentValue = await window.__webbridge_sync(this.className, this.objectId, "prop", this.propName);
+            this.currentValue = await __webbridge_decodeWire(await __webbridge_syncBatched(this.classId, this.objectId, 0, this.propIdx));
             this.loaded = true;
         }
         return this.currentValue;
     }
 
+    // Seeds the store from a bulk snapshot (op 3). A real notification
+    // that raced ahead wins - it is newer than the snapshot.
+    _hydrate(value) {
+        if (this.loaded) {
+            return;
+        }
+        this.currentValue = value;
+        this.loaded = true;
+    }
+
     _notify(value) {
+        if (value !== null && typeof value === 'object' && typeof value.$blob === 'string') {
+            // Blob tickets resolve asynchronously - re-enter once fetched
+            __webbridge_decodeWire(value).then((v) => this._notify(v));
+            return;
+        }
+        value = __webbridge_decodeWire(value);
+        if (value !== null && typeof value === 'object' && Array.isArray(value.$patch)) {
+            if (!this.loaded) {
+                // No base to patch (notification raced ahead of the
+                // hydration) - fetch the full value once instead
+                __webbridge_syncBatched(this.classId, this.objectId, 0, this.propIdx)
+                    .then(__webbridge_decodeWire)
+                    .then((v) => this._notify(v));
+                return;
+            }
+            value = __webbridge_applyPatch(this.currentValue, value.$patch);
+        }
         this.currentValue = value;
         this.loaded = true;
         for (const fn of this.subscribers) {
@@ -104,8 +521,8 @@ class PropertyStore {
     }
 }
 
-function __webbridge_createProperty(objectId, className, propName) {
-    return new PropertyStore(objectId, className, propName);
+function __webbridge_createProperty(objectId, classId, propName, propIdx) {
+    return new PropertyStore(objectId, classId, propName, propIdx);
 }
 
 // =============================================================================
@@ -161,7 +578,8 @@ function __webbridge_createEvent() {
 // =============================================================================
 
 function __webbridge_createClass(config) {
-    const { className, properties, events, syncMethods, asyncMethods, instanceConstants, staticConstants } = config;
+    const { className, classId, properties, events, syncMethods, asyncMethods, instanceConstants, staticConstants } = config;
+    const binaryThreshold = config.binaryProtocol ? config.binaryThreshold : 0;
 
     console.log(`[WebBridge] createClass: ${className}`);
 
@@ -177,12 +595,19 @@ function __webbridge_createClass(config) {
     const staticKeys = Object.keys(staticConstants);
     const staticCount = staticKeys.length;
 
-    // Pre-build sync method wrappers using universal dispatcher
+    // Pre-build sync method wrappers using universal dispatcher.
+    // Member names were resolved to indices once - per call only small
+    // integers travel over the bridge (op 2 = call).
     const syncMethodWrappers = {};
     for (let i = 0; i < syncMethodCount; i++) {
         const methodName = syncMethods[i];
+        const methodIdx = i;
         syncMethodWrappers[methodName] = function(...args) {
-            return window.__webbridge_sync(className, this.__id, "call", methodName, ...args);
+            args = args.map(__webbridge_maybeEncodeTyped);
+            if (binaryThreshold > 0) {
+                args = args.map((a) => __webbridge_maybeEncodeWire(a, binaryThreshold));
+            }
+            return __webbridge_syncBatched(classId, this.__id, 2, methodIdx, ...args).then(__webbridge_decodeWire);
         };
     }
 
@@ -190,15 +615,30 @@ function __webbridge_createClass(config) {
     const asyncMethodWrappers = {};
     for (let i = 0; i < asyncMethodCount; i++) {
         const methodName = asyncMethods[i];
+        const methodIdx = i;
         asyncMethodWrappers[methodName] = function(...args) {
-            return window.__webbridge_async(className, this.__id, methodName, ...args);
+            args = args.map(__webbridge_maybeEncodeTyped);
+            if (binaryThreshold > 0) {
+                args = args.map((a) => __webbridge_maybeEncodeWire(a, binaryThreshold));
+            }
+            const callId = ++__webbridge_callSeq;
+            const promise = window.__webbridge_async(classId, this.__id, methodIdx, callId, ...args).then(__webbridge_decodeWire);
+            // Abort the call: queued work is skipped, running work sees
+            // its cancellation token flip and can bail out early.
+            promise.cancel = () => window.__webbridge_cancel(callId);
+            return promise;
         };
     }
 
     const factory = {
         async create(...args) {
-            // Use universal create dispatcher
-            const objectId = await window.__webbridge_create(className, ...args);
+            // Universal create dispatcher (interned class id) returns the
+            // full creation descriptor {id, constants, props} - one
+            // round-trip regardless of how many members the class has.
+            args = args.map(__webbridge_maybeEncodeTyped);
+            const descriptor = await __webbridge_decodeWire(
+                await window.__webbridge_create(classId, ...args));
+            const objectId = descriptor.id;
 
             // Build property descriptors for all members at once
             const descriptors = {
@@ -221,6 +661,9 @@ function __webbridge_createClass(config) {
                 },
                 destroy: {
                     value: function() {
+                        // Deterministic release: take over from the GC
+                        // safety net so the id is never freed twice
+                        __webbridge_finalizers.unregister(this);
                         delete __webbridge_objects[this.__id];
                         window.__webbridge_destroy(this.__id);
                     },
@@ -234,7 +677,7 @@ function __webbridge_createClass(config) {
             for (let i = 0; i < propCount; i++) {
                 const propName = properties[i];
                 descriptors[propName] = {
-                    value: __webbridge_createProperty(objectId, className, propName),
+                    value: __webbridge_createProperty(objectId, classId, propName, i),
                     writable: false,
                     enumerable: true,
                     configurable: false
@@ -273,16 +716,13 @@ function __webbridge_createClass(config) {
                 };
             }
             
-            // Fetch all instance constants in parallel
+            // Instance constants arrive in the creation descriptor -
+            // no separate fetches
             if (instanceConstCount > 0) {
-                const constPromises = new Array(instanceConstCount);
-                for (let i = 0; i < instanceConstCount; i++) {
-                    constPromises[i] = window.__webbridge_sync(className, objectId, "const", instanceConstants[i]);
-                }
-                const constValues = await Promise.all(constPromises);
+                const constValues = descriptor.constants || {};
                 for (let i = 0; i < instanceConstCount; i++) {
                     descriptors[instanceConstants[i]] = {
-                        value: constValues[i],
+                        value: constValues[instanceConstants[i]],
                         writable: false,
                         enumerable: true,
                         configurable: false
@@ -301,8 +741,27 @@ function __webbridge_createClass(config) {
                 };
             }
 
+            // Initial property values ride along in the creation
+            // descriptor - pre-hydrate every PropertyStore so mounting a
+            // view costs zero further round-trips. (The op-3 snapshot
+            // stays available for re-hydrating later.)
+            const initialProps = descriptor.props;
+            if (initialProps && typeof initialProps === 'object') {
+                for (let i = 0; i < propCount; i++) {
+                    const propName = properties[i];
+                    if (Object.prototype.hasOwnProperty.call(initialProps, propName)) {
+                        // Numeric containers ride along as $typed envelopes
+                        descriptors[propName].value._hydrate(
+                            __webbridge_decodeWire(initialProps[propName]));
+                    }
+                }
+            }
+
             const obj = Object.create(Object.prototype, descriptors);
-            __webbridge_objects[objectId] = obj;
+            __webbridge_objects[objectId] = new WeakRef(obj);
+            // The proxy itself doubles as the unregister token for
+            // explicit destroy() (tokens are held weakly)
+            __webbridge_finalizers.register(obj, objectId, obj);
             return obj;
         }
     };
@@ -320,12 +779,82 @@ function __webbridge_createClass(config) {
 console.log('[WebBridge] Runtime loaded (Dispatcher Version)');
 )JS";
 
+// Shared by the single-call and batch bindings: resolves the handler
+// (interned class id or legacy name), maps op code and member index back
+// to their interned names and runs the sync handler. Returns the
+// handler's {status, wire_json} pair; the caller resolves the Promise.
+// Legacy string requests carry the operation by name; map it back to
+// the numeric slot the per-class metrics counters use.
+static size_t metrics_op_slot(std::string_view operation) {
+	for (int code = 0; code <= 3; ++code) {
+		if (operation == op_name(code)) {
+			return static_cast<size_t>(code);
+		}
+	}
+	return 2; // unknown -> count as "call", the handler will reject it anyway
+}
+
+static std::tuple<int, std::string> dispatch_sync_call(
+	object_registry& registry,
+	dispatcher_registry& dispatcher,
+	const nlohmann::json& args)
+{
+	// Views into the parsed DOM - no copies during dispatch.
+	// The DOM outlives the handler call, so this is safe.
+	std::string_view object_id = args.at(1).get_ref<const std::string&>();
+
+	if (args.at(0).is_number()) {
+		// Interned fast path: [classId, objectId, opCode, memberIdx, ...]
+		// resolves via flat array indexing - no string hashing
+		const auto& handler = dispatcher.get_handler(args.at(0).get<uint32_t>());
+		auto op_code = args.at(2).get<int>();
+		const auto& operation = op_name(op_code);
+		// Snapshot (op 3) addresses the whole object - no member
+		std::string_view member = op_code == 3
+			? std::string_view{}
+			: std::string_view(handler.members.member_name(op_code, args.at(3).get<size_t>()));
+		trace_span span("dispatch.sync", [&] {
+			return op_code == 3
+				? handler.class_name + ".snapshot"
+				: handler.class_name + "." + std::string(member);
+		});
+		bridge_metrics::instance().count_call(handler.class_id, static_cast<size_t>(op_code));
+		const auto start_us = trace_now_us();
+		auto result = handler.sync(registry, object_id, operation, member, args);
+		bridge_metrics::instance().record_sync_latency(
+			static_cast<uint64_t>(trace_now_us() - start_us));
+		return result;
+	}
+
+	std::string_view class_name = args.at(0).get_ref<const std::string&>();
+	std::string_view operation = args.at(2).get_ref<const std::string&>();
+	std::string_view member = args.at(3).get_ref<const std::string&>();
+
+	const auto& handler = dispatcher.get_handler(std::string(class_name));
+	trace_span span("dispatch.sync", [&] { return std::string(class_name) + "." + std::string(member); });
+	bridge_metrics::instance().count_call(handler.class_id, metrics_op_slot(operation));
+	const auto start_us = trace_now_us();
+	auto result = handler.sync(registry, object_id, operation, member, args);
+	bridge_metrics::instance().record_sync_latency(
+		static_cast<uint64_t>(trace_now_us() - start_us));
+	return result;
+}
+
 void init_webview(webview::webview* ptr, obj_deleter_fun fun) {
-	if (!ptr || initialized_webviews.count(ptr)) {
+	if (!ptr) {
 		return;
 	}
 
-	auto& registry = object_registry::instance();
+	// Per-window context: each webview dispatches against its OWN
+	// object registry, so multiple windows never contend on the same
+	// shard mutexes. The handler table stays process-wide (read-only
+	// after startup).
+	auto& context = bridge_context::for_webview(ptr);
+	if (context.initialized()) {
+		return;
+	}
+
+	auto& registry = context.registry();
 	auto& dispatcher = dispatcher_registry::instance();
 
 	// Inject the WebBridge runtime
@@ -339,18 +868,26 @@ void init_webview(webview::webview* ptr, obj_deleter_fun fun) {
 	ptr->bind("__webbridge_create",
 		[&registry, &dispatcher, ptr](const std::string& req_id, const std::string& req, void*) {
 			try {
-				auto args = nlohmann::json::parse(req);
-				auto class_name = args.at(0).get<std::string>();
-				
-				// Remove className from args, pass rest to handler
+				auto args = parse_request(req);
+
+				// Numeric class id (interned) or legacy class name string
+				const auto& handler = args.at(0).is_number()
+					? dispatcher.get_handler(args.at(0).get<uint32_t>())
+					: dispatcher.get_handler(args.at(0).get<std::string>());
+
+				// Remove className from args, pass rest to handler.
+				// Elements are moved, not deep-copied.
 				nlohmann::json create_args = nlohmann::json::array();
 				for (size_t i = 1; i < args.size(); ++i) {
-					create_args.push_back(args[i]);
+					create_args.push_back(std::move(args[i]));
 				}
-				
-				const auto& handler = dispatcher.get_handler(class_name);
-				auto object_id = handler.create(*ptr, registry, create_args);
-				ptr->resolve(req_id, 0, nlohmann::json(object_id).dump());
+				expand_request_envelopes(create_args);
+				bridge_metrics::instance().count_call(handler.class_id, bridge_metrics::OP_CREATE);
+				bridge_metrics::instance().add_bytes_in(req.size());
+				auto descriptor = handler.create(*ptr, registry, create_args);
+				auto wire = serialize_for_wire(descriptor);
+				bridge_metrics::instance().add_bytes_out(wire.size());
+				ptr->resolve(req_id, 0, wire);
 			} catch (const std::exception& e) {
 				ptr->resolve(req_id, 1, nlohmann::json{{"error", e.what()}}.dump());
 			}
@@ -359,33 +896,166 @@ void init_webview(webview::webview* ptr, obj_deleter_fun fun) {
 	// 2. Universal SYNC dispatcher
 	ptr->bind("__webbridge_sync",
 		[&registry, &dispatcher, ptr](const std::string& req_id, const std::string& req, void*) {
-            auto args = nlohmann::json::parse(req);
-            auto class_name = args.at(0).get<std::string>();
-            auto object_id = args.at(1).get<std::string>();
-            auto operation = args.at(2).get<std::string>();
-            auto member = args.at(3).get<std::string>();
-            
-            const auto& handler = dispatcher.get_handler(class_name);
-            handler.sync(*ptr, registry, req_id, object_id, operation, member, args);
+            try {
+                auto args = parse_request(req);
+                expand_request_envelopes(args);
+                auto [status, result] = dispatch_sync_call(registry, dispatcher, args);
+                bridge_metrics::instance().add_bytes_in(req.size());
+                bridge_metrics::instance().add_bytes_out(result.size());
+                ptr->resolve(req_id, status, result);
+            } catch (const std::exception& e) {
+                ptr->resolve(req_id, 1, nlohmann::json{{"error", e.what()}}.dump());
+            }
+		}, nullptr);
+
+	// 2b. BATCH dispatcher: the JS micro-batcher collects all sync calls
+	// issued within the same microtask and ships them as ONE crossing:
+	// [[classId, objectId, opCode, memberIdx, ...args], ...]
+	// The response carries all results in request order as
+	// [[status, value], ...] - N fixed bridge overheads collapse into
+	// one, and a failing call only rejects its own Promise.
+	ptr->bind("__webbridge_batch",
+		[&registry, &dispatcher, ptr](const std::string& req_id, const std::string& req, void*) {
+            // Outer try/catch mirrors __webbridge_sync: a malformed batch
+            // envelope (missing/non-array argument) must reject the batch
+            // Promise, not escape the bind callback and kill the host.
+            // Per-call failures below still only fail their own slot.
+            try {
+                auto calls = parse_request(req).at(0);
+                trace_span span("dispatch.batch", [&] {
+                    return "batch(" + std::to_string(calls.size()) + ")";
+                });
+
+                // Sub-results are raw wire text (envelopes included), so the
+                // response is assembled directly in an arena buffer instead
+                // of re-parsing every result into a DOM.
+                arena_buffer buffer;
+                auto& out = buffer.str();
+                out += '[';
+                bool first = true;
+                for (auto& call : calls) {
+                    int status = 1;
+                    std::string result;
+                    try {
+                        expand_request_envelopes(call);
+                        std::tie(status, result) = dispatch_sync_call(registry, dispatcher, call);
+                    } catch (const std::exception& e) {
+                        result = nlohmann::json{{"error", e.what()}}.dump();
+                    }
+                    if (!first) {
+                        out += ',';
+                    }
+                    first = false;
+                    out += '[';
+                    out += std::to_string(status);
+                    out += ',';
+                    out += result;
+                    out += ']';
+                }
+                out += ']';
+                bridge_metrics::instance().add_bytes_in(req.size());
+                bridge_metrics::instance().add_bytes_out(out.size());
+                ptr->resolve(req_id, 0, out);
+            } catch (const std::exception& e) {
+                ptr->resolve(req_id, 1, nlohmann::json{{"error", e.what()}}.dump());
+            }
 		}, nullptr);
 
 	// 3. Universal ASYNC dispatcher (uses thread pool instead of std::thread)
 	ptr->bind("__webbridge_async",
 		[&registry, &dispatcher, ptr](const std::string& req_id, const std::string& req, void*) {
-            auto args = nlohmann::json::parse(req);
-            auto class_name = args.at(0).get<std::string>();
-            auto object_id = args.at(1).get<std::string>();
-            auto method = args.at(2).get<std::string>();
-            
-            const auto& handler = dispatcher.get_handler(class_name);
-            
-            // Submit to thread pool instead of creating new thread each time
-            // This saves ~50-100µs per async call!
-            get_thread_pool().submit([handler, ptr, &registry, req_id, object_id, method, args]() {
-                handler.async(*ptr, registry, req_id, object_id, method, args);
-            });
+            // Outer try/catch mirrors __webbridge_sync: malformed input
+            // (too few elements, wrong types, bad envelope base64) must
+            // reject this call's Promise, not escape the bind callback.
+            try {
+                auto args = parse_request(req);
+                expand_request_envelopes(args);
+
+                // Interned fast path sends [classId, objectId, methodIdx,
+                // callId, ...args]. The legacy string form
+                // [className, objectId, methodName, ...args] carries NO call
+                // id - index 3 is the first method argument there, so it
+                // must not be read as one. Legacy calls run without
+                // cancellation support (call_id 0 = not registered).
+                const bool interned = args.at(0).is_number();
+                const uint64_t call_id = interned ? args.at(3).get<uint64_t>() : 0;
+
+                const auto& handler = interned
+                    ? dispatcher.get_handler(args.at(0).get<uint32_t>())
+                    : dispatcher.get_handler(args.at(0).get<std::string>());
+                std::string_view method = args.at(2).is_number()
+                    ? std::string_view(handler.members.async_method_name(args.at(2).get<size_t>()))
+                    : std::string_view(args.at(2).get_ref<const std::string&>());
+
+                // Token so JS can abort the call; priority lane from the
+                // method's [[async(...)]] attribute (default: normal)
+                auto token = call_id != 0
+                    ? cancellation_registry::instance().register_call(call_id)
+                    : cancellation_token{};
+
+                // Async responses resolve inside the generated handlers, so
+                // only the request bytes are visible at this binding. The
+                // latency clock starts HERE: queue wait is part of what the
+                // frontend experiences, so it belongs in the percentiles.
+                bridge_metrics::instance().count_call(handler.class_id, bridge_metrics::OP_ASYNC);
+                bridge_metrics::instance().add_bytes_in(req.size());
+                const auto submitted_us = trace_now_us();
+
+                // Submit to thread pool instead of creating new thread each time
+                // This saves ~50-100µs per async call!
+                // Handler nodes are stable (see dispatcher_registry), so the
+                // task captures a pointer instead of copying the handler; the
+                // args DOM is moved in and object_id/method are re-derived as
+                // views into that captured copy.
+                const class_handler* handler_ptr = &handler;
+                get_thread_pool().submit(handler.priority_for(method),
+                    [handler_ptr, ptr, &registry, req_id, args = std::move(args), call_id, token, submitted_us]() {
+                        std::string_view object_id = args.at(1).get_ref<const std::string&>();
+                        std::string_view method = args.at(2).is_number()
+                            ? std::string_view(handler_ptr->members.async_method_name(args.at(2).get<size_t>()))
+                            : std::string_view(args.at(2).get_ref<const std::string&>());
+
+                        if (token.cancelled()) {
+                            // Cancelled while queued - reject without occupying the worker
+                            ptr->resolve(req_id, 1,
+                                error(CALL_CANCELLED, "Async call cancelled: " + std::string(method)).dump());
+                        } else {
+                            set_current_cancellation_token(token);
+                            {
+                                trace_span span("dispatch.async", [&] { return handler_ptr->class_name + "." + std::string(method); });
+                                handler_ptr->async(*ptr, registry, req_id, object_id, method, args);
+                            }
+                            set_current_cancellation_token({});
+                            bridge_metrics::instance().record_async_latency(
+                                static_cast<uint64_t>(trace_now_us() - submitted_us));
+                        }
+                        if (call_id != 0) {
+                            cancellation_registry::instance().complete(call_id);
+                        }
+                    },
+                    // Queue bound hit (or shed as victim): reject the Promise
+                    // right away so the frontend can degrade instead of
+                    // waiting on a call that will never run
+                    [ptr, req_id, call_id]() {
+                        ptr->resolve(req_id, 1,
+                            error(QUEUE_OVERLOADED, "Async call rejected: task queue overloaded").dump());
+                        if (call_id != 0) {
+                            cancellation_registry::instance().complete(call_id);
+                        }
+                    });
+            } catch (const std::exception& e) {
+                ptr->resolve(req_id, 1, nlohmann::json{{"error", e.what()}}.dump());
+            }
 		}, nullptr);
 
+	// Cancels an in-flight async call by its JS-generated call id
+	ptr->bind("__webbridge_cancel", [](const std::string& req) -> std::string {
+		auto args = nlohmann::json::parse(req);
+		auto call_id = args.at(0).get<uint64_t>();
+		bool found = cancellation_registry::instance().cancel(call_id);
+		return found ? "true" : "false";
+	});
+
 	// 4. Universal DESTROY dispatcher
 	ptr->bind("__webbridge_destroy", [fun](const std::string& req) -> std::string {
 		auto args = nlohmann::json::parse(req);
@@ -394,11 +1064,70 @@ void init_webview(webview::webview* ptr, obj_deleter_fun fun) {
 		return "null";
 	});
 
-	initialized_webviews.insert(ptr);
+	// 4b. Batched DESTROY: the GC reclamation path in the runtime
+	// collects finalized proxy ids and releases a whole burst with one
+	// crossing instead of one __webbridge_destroy call per object
+	ptr->bind("__webbridge_destroy_batch", [fun](const std::string& req) -> std::string {
+		auto args = nlohmann::json::parse(req);
+		for (const auto& id : args.at(0)) {
+			fun(id.get<std::string>());
+		}
+		return "null";
+	});
+
+	context.mark_initialized();
 }
 
 bool is_webview_initialized(webview::webview* ptr) {
-	return ptr && initialized_webviews.count(ptr) > 0;
+	return ptr && bridge_context::for_webview(ptr).initialized();
+}
+
+// =============================================================================
+// Class-Config Batching
+// =============================================================================
+
+// Per-webview pending config scripts; a present key means a batch is
+// open. All registration happens on the main thread before run(), so no
+// locking is needed here.
+static std::unordered_map<webview::webview*, std::vector<std::string>> pending_class_configs;
+
+static std::string wrap_class_configs(const std::vector<std::string>& configs) {
+	std::string js;
+	js.reserve(64 + configs.size() * 512);
+	js += "(function() {\n\ttry {\n";
+	for (const auto& config : configs) {
+		js += config;
+	}
+	js += "\t} catch (error) {\n"
+		"\t\tconsole.error('[Webbridge] Error registering classes:', error);\n"
+		"\t\tthrow error;\n"
+		"\t}\n})();\n";
+	return js;
+}
+
+void begin_class_config_batch(webview::webview* ptr) {
+	pending_class_configs.try_emplace(ptr);
+}
+
+void queue_js_class_config(webview::webview* ptr, std::string config_js) {
+	auto it = pending_class_configs.find(ptr);
+	if (it != pending_class_configs.end()) {
+		it->second.push_back(std::move(config_js));
+		return;
+	}
+	// No batch open (per-class register_type<T>() path): inject directly
+	ptr->init(wrap_class_configs({std::move(config_js)}));
+}
+
+void flush_js_class_configs(webview::webview* ptr) {
+	auto it = pending_class_configs.find(ptr);
+	if (it == pending_class_configs.end()) {
+		return;
+	}
+	if (!it->second.empty()) {
+		ptr->init(wrap_class_configs(it->second));
+	}
+	pending_class_configs.erase(it);
 }
 
 std::string generate_js_class_wrapper(
@@ -411,24 +1140,21 @@ std::string generate_js_class_wrapper(
 	const nlohmann::json& static_constants)
 {
 	// Runtime is already injected via init_webview
-	// JS now uses universal __webbridge_* functions instead of per-class bindings
-	std::string js = std::format(R"(
-(function() {{
-	try {{
-		__webbridge_createClass({{
+	// JS now uses universal __webbridge_* functions instead of per-class bindings.
+	// Bare createClass call - IIFE/try-catch wrapping happens when the
+	// batch (or single config) is injected, so N classes share one script.
+	std::string js = std::format(R"(		__webbridge_createClass({{
 			className: "{0}",
+			classId: {9},
 			properties: {1},
 			events: {2},
 			syncMethods: {3},
 			asyncMethods: {4},
 			instanceConstants: {5},
-			staticConstants: {6}
+			staticConstants: {6},
+			binaryProtocol: {7},
+			binaryThreshold: {8}
 		}});
-	}} catch (error) {{
-		console.error('[Webbridge] Error creating class {0}:', error);
-		throw error;
-	}}
-}})();
 )",
 		type_name,
 		nlohmann::json(properties).dump(),
@@ -436,7 +1162,10 @@ std::string generate_js_class_wrapper(
 		nlohmann::json(sync_methods).dump(),
 		nlohmann::json(async_methods).dump(),
 		nlohmann::json(instance_constants).dump(),
-		static_constants.dump());
+		static_constants.dump(),
+		get_wire_format(type_name) == wire_format::cbor ? "true" : "false",
+		get_binary_wire_threshold(),
+		dispatcher_registry::instance().get_handler(std::string(type_name)).class_id);
 
 	return js;
 }
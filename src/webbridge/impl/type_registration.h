@@ -19,7 +19,22 @@ void init_webview(webview::webview* ptr, obj_deleter_fun fun);
 // Query if init_webview was called for this webview
 bool is_webview_initialized(webview::webview* ptr);
 
-// Returns JS code for a class wrapper for a C++ type.
+// Opens a class-config batch for this webview: subsequent
+// queue_js_class_config() calls collect instead of injecting, until
+// flush_js_class_configs() emits them as ONE init() script. Used by the
+// generated register_all_classes() bundle so startup does a single
+// script evaluation instead of one per class.
+void begin_class_config_batch(webview::webview* ptr);
+
+// Queues (inside an open batch) or immediately injects (outside one)
+// a __webbridge_createClass(...) config script.
+void queue_js_class_config(webview::webview* ptr, std::string config_js);
+
+// Closes the batch and injects all queued configs via a single init().
+void flush_js_class_configs(webview::webview* ptr);
+
+// Returns JS code for a class wrapper for a C++ type: a bare
+// __webbridge_createClass({...}); call suitable for batching.
 // The JS code uses universal dispatcher functions instead of per-class bindings.
 // Requires init_webview to be called first to inject the runtime.
 std::string generate_js_class_wrapper(
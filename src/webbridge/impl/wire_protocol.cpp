@@ -0,0 +1,222 @@
+#include "wire_protocol.h"
+#include "blob_store.h"
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <stdexcept>
+
+namespace webbridge::impl {
+
+// =============================================================================
+// Configuration State
+// =============================================================================
+
+namespace {
+
+// Per-class wire formats. Written during registration (startup),
+// read when the JS class config is generated.
+std::mutex g_wire_format_mutex;
+std::unordered_map<std::string, wire_format> g_wire_formats;
+
+// 0 = binary encoding disabled. Values smaller than the threshold are
+// cheaper as plain JSON text, so only large payloads take the CBOR path.
+std::atomic<size_t> g_binary_threshold{0};
+
+// 0 = blob offload disabled
+std::atomic<size_t> g_blob_threshold{0};
+
+constexpr char BASE64_CHARS[] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+} // namespace
+
+void set_wire_format(std::string_view class_name, wire_format format) {
+	std::lock_guard lock(g_wire_format_mutex);
+	g_wire_formats[std::string(class_name)] = format;
+}
+
+wire_format get_wire_format(std::string_view class_name) {
+	std::lock_guard lock(g_wire_format_mutex);
+	auto it = g_wire_formats.find(std::string(class_name));
+	return it != g_wire_formats.end() ? it->second : wire_format::json;
+}
+
+void set_binary_wire_threshold(size_t bytes) {
+	g_binary_threshold.store(bytes, std::memory_order_relaxed);
+}
+
+size_t get_binary_wire_threshold() {
+	return g_binary_threshold.load(std::memory_order_relaxed);
+}
+
+void set_blob_offload_threshold(size_t bytes) {
+	g_blob_threshold.store(bytes, std::memory_order_relaxed);
+}
+
+size_t get_blob_offload_threshold() {
+	return g_blob_threshold.load(std::memory_order_relaxed);
+}
+
+// =============================================================================
+// Base64
+// =============================================================================
+
+std::string base64_encode(const std::vector<uint8_t>& data) {
+	return base64_encode(data.data(), data.size());
+}
+
+std::string base64_encode(const uint8_t* data, size_t size) {
+	std::string out;
+	out.reserve(((size + 2) / 3) * 4);
+
+	size_t i = 0;
+	while (i + 2 < size) {
+		uint32_t triple = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+		out.push_back(BASE64_CHARS[(triple >> 18) & 0x3F]);
+		out.push_back(BASE64_CHARS[(triple >> 12) & 0x3F]);
+		out.push_back(BASE64_CHARS[(triple >> 6) & 0x3F]);
+		out.push_back(BASE64_CHARS[triple & 0x3F]);
+		i += 3;
+	}
+
+	if (i + 1 == size) {
+		uint32_t triple = data[i] << 16;
+		out.push_back(BASE64_CHARS[(triple >> 18) & 0x3F]);
+		out.push_back(BASE64_CHARS[(triple >> 12) & 0x3F]);
+		out.append("==");
+	} else if (i + 2 == size) {
+		uint32_t triple = (data[i] << 16) | (data[i + 1] << 8);
+		out.push_back(BASE64_CHARS[(triple >> 18) & 0x3F]);
+		out.push_back(BASE64_CHARS[(triple >> 12) & 0x3F]);
+		out.push_back(BASE64_CHARS[(triple >> 6) & 0x3F]);
+		out.push_back('=');
+	}
+
+	return out;
+}
+
+std::vector<uint8_t> base64_decode(std::string_view text) {
+	static const auto decode_table = []() {
+		std::array<int8_t, 256> table;
+		table.fill(-1);
+		for (int i = 0; i < 64; ++i) {
+			table[static_cast<uint8_t>(BASE64_CHARS[i])] = static_cast<int8_t>(i);
+		}
+		return table;
+	}();
+
+	std::vector<uint8_t> out;
+	out.reserve((text.size() / 4) * 3);
+
+	uint32_t buffer = 0;
+	int bits = 0;
+	for (char c : text) {
+		if (c == '=') {
+			break;
+		}
+		int8_t value = decode_table[static_cast<uint8_t>(c)];
+		if (value < 0) {
+			throw std::invalid_argument("Invalid base64 character in CBOR envelope");
+		}
+		buffer = (buffer << 6) | static_cast<uint32_t>(value);
+		bits += 6;
+		if (bits >= 8) {
+			bits -= 8;
+			out.push_back(static_cast<uint8_t>((buffer >> bits) & 0xFF));
+		}
+	}
+
+	return out;
+}
+
+// =============================================================================
+// Envelope Handling
+// =============================================================================
+
+std::string serialize_for_wire(const nlohmann::json& value) {
+	auto text = value.dump();
+
+	// Very large payloads leave the bind channel entirely: park the
+	// CBOR bytes in the blob store and send only the fetch ticket.
+	auto blob_threshold = g_blob_threshold.load(std::memory_order_relaxed);
+	if (blob_threshold > 0 && text.size() >= blob_threshold) {
+		auto& store = blob_store::instance();
+		if (store.available()) {
+			auto bytes = store.acquire_buffer();
+			nlohmann::json::to_cbor(value, bytes);
+			auto url = store.park(std::move(bytes), "application/cbor");
+			return nlohmann::json{{"$blob", std::move(url)}}.dump();
+		}
+	}
+
+	auto threshold = g_binary_threshold.load(std::memory_order_relaxed);
+	if (threshold == 0 || text.size() < threshold) {
+		return text;
+	}
+
+	nlohmann::json envelope{{"$cbor", base64_encode(nlohmann::json::to_cbor(value))}};
+	return envelope.dump();
+}
+
+bool is_cbor_envelope(const nlohmann::json& j) {
+	return j.is_object() && j.size() == 1 && j.contains("$cbor") && j["$cbor"].is_string();
+}
+
+nlohmann::json decode_cbor_envelope(const nlohmann::json& envelope) {
+	auto bytes = base64_decode(envelope.at("$cbor").get_ref<const std::string&>());
+	return nlohmann::json::from_cbor(bytes);
+}
+
+bool is_typed_envelope(const nlohmann::json& j) {
+	return j.is_object() && j.size() == 1 && j.contains("$typed") && j["$typed"].is_object();
+}
+
+nlohmann::json decode_typed_envelope(const nlohmann::json& envelope) {
+	const auto& typed = envelope.at("$typed");
+	auto bytes = base64_decode(typed.at("b").get_ref<const std::string&>());
+	const auto& tag = typed.at("t").get_ref<const std::string&>();
+
+	// Rebuild a plain JSON number array: the generated handlers convert
+	// via get<std::vector<T>>() and stay envelope-agnostic. Both sides
+	// are little-endian (x86/WebView2), so the bytes map 1:1.
+	nlohmann::json out = nlohmann::json::array();
+	auto fill = [&]<typename T>(T) {
+		const size_t count = bytes.size() / sizeof(T);
+		const T* values = reinterpret_cast<const T*>(bytes.data());
+		for (size_t i = 0; i < count; ++i) {
+			out.push_back(values[i]);
+		}
+	};
+
+	if      (tag == "i8")  fill(int8_t{});
+	else if (tag == "u8")  fill(uint8_t{});
+	else if (tag == "i16") fill(int16_t{});
+	else if (tag == "u16") fill(uint16_t{});
+	else if (tag == "i32") fill(int32_t{});
+	else if (tag == "u32") fill(uint32_t{});
+	else if (tag == "f32") fill(float{});
+	else if (tag == "f64") fill(double{});
+	else {
+		throw std::invalid_argument("Unknown TypedArray tag: " + tag);
+	}
+	return out;
+}
+
+void expand_request_envelopes(nlohmann::json& args) {
+	if (!args.is_array()) {
+		return;
+	}
+	for (auto& element : args) {
+		if (is_cbor_envelope(element)) {
+			element = decode_cbor_envelope(element);
+		}
+		// Not else-if: a typed envelope can come back out of a CBOR one
+		// when the class also opted into binary mode.
+		if (is_typed_envelope(element)) {
+			element = decode_typed_envelope(element);
+		}
+	}
+}
+
+} // namespace webbridge::impl
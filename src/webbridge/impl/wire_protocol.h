@@ -0,0 +1,97 @@
+#pragma once
+
+/**
+ * WebBridge Wire Protocol
+ *
+ * The webview bind pipe transports strings, so by default every call
+ * round-trips its arguments and results as JSON text. For struct-heavy
+ * payloads the text encode/decode becomes a measurable part of the
+ * per-call overhead (see doc/performance.md).
+ *
+ * This module adds an opt-in binary mode: values are encoded as CBOR
+ * (via nlohmann::json::to_cbor) and carried through the string pipe as
+ * a base64 envelope:
+ *
+ *   {"$cbor": "<base64 bytes>"}
+ *
+ * The mode is negotiated per class at register_type<T>() time:
+ * enable_binary_protocol("MyObject") must be called before the type is
+ * registered, so the injected JS class config carries binaryProtocol=true
+ * and the runtime encodes/decodes symmetrically. Payloads below the
+ * configured threshold keep the plain JSON path - for small calls the
+ * envelope would only add overhead.
+ */
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+
+namespace webbridge::impl {
+
+// =============================================================================
+// Wire Format Selection
+// =============================================================================
+
+enum class wire_format {
+	json,	// Plain JSON text (default)
+	cbor	// CBOR inside a {"$cbor": base64} envelope
+};
+
+// Per-class opt-in. Must be called before register_type<T>() so the
+// generated JS class config picks up the flag.
+void set_wire_format(std::string_view class_name, wire_format format);
+wire_format get_wire_format(std::string_view class_name);
+
+// Minimum serialized size (JSON text bytes) before a value is moved to
+// the binary envelope. 0 disables binary encoding entirely.
+void set_binary_wire_threshold(size_t bytes);
+size_t get_binary_wire_threshold();
+
+// Minimum serialized size before a value leaves the bind channel
+// entirely and is parked in the blob store (fetched by JS as an
+// ArrayBuffer via the ResourceServer). 0 disables blob offload.
+void set_blob_offload_threshold(size_t bytes);
+size_t get_blob_offload_threshold();
+
+// =============================================================================
+// Base64 (for carrying CBOR bytes through the string pipe)
+// =============================================================================
+
+std::string base64_encode(const uint8_t* data, size_t size);
+std::string base64_encode(const std::vector<uint8_t>& data);
+std::vector<uint8_t> base64_decode(std::string_view text);
+
+// =============================================================================
+// Envelope Handling
+// =============================================================================
+
+// Serializes a value for the wire. Returns plain dump() unless binary
+// encoding is enabled and the JSON text would exceed the threshold, in
+// which case a {"$cbor": ...} envelope string is returned instead.
+std::string serialize_for_wire(const nlohmann::json& value);
+
+// Returns true if j is a {"$cbor": ...} envelope.
+bool is_cbor_envelope(const nlohmann::json& j);
+
+// Decodes a {"$cbor": ...} envelope back into a JSON value.
+nlohmann::json decode_cbor_envelope(const nlohmann::json& envelope);
+
+// Returns true if j is a {"$typed": {"t":..., "b":...}} TypedArray
+// envelope (numeric container as raw little-endian bytes, see
+// binding_helpers.h).
+bool is_typed_envelope(const nlohmann::json& j);
+
+// Expands a {"$typed": ...} envelope back into a JSON number array, so
+// the generated get<std::vector<T>>() conversions keep working.
+nlohmann::json decode_typed_envelope(const nlohmann::json& envelope);
+
+// Expands any {"$cbor": ...} or {"$typed": ...} envelopes found in the
+// top-level elements of a request argument array in place. Called by
+// the universal dispatchers before handing args to the generated
+// handlers, so the handlers keep their nlohmann-facing interface.
+void expand_request_envelopes(nlohmann::json& args);
+
+} // namespace webbridge::impl
@@ -2,7 +2,13 @@
 
 #include "impl/property_impl.h"
 #include "impl/event_impl.h"
+#include "impl/task_impl.h"
+#include "impl/bridge_context.h"
 #include "impl/thread_pool.h"
+#include "impl/wire_protocol.h"
+#include "impl/fast_parse.h"
+#include "impl/event_channel.h"
+#include "impl/cancellation.h"
 #include <webview/webview.h>
 #include <memory>
 
@@ -16,9 +22,26 @@ class object
 public:
 	template<typename T>
 	using property = impl::property<T>;
-	
+
+	/**
+	 * Abgeleiteter Wert aus mehreren Input-Properties: lazy, höchstens
+	 * eine Neuberechnung pro Notification-Flush, Notification nur bei
+	 * tatsächlich geändertem Ergebnis. Aus JS-Sicht ein normales
+	 * read-only Property. (siehe impl/property_impl.h)
+	 */
+	template<typename T>
+	using computed_property = impl::computed_property<T>;
+
 	template<typename... Args>
 	using event = impl::event<Args...>;
+
+	/**
+	 * Coroutine-Rückgabetyp für Async-Methoden: läuft auf dem Worker
+	 * nur bis zum ersten co_await. Parameter by value nehmen!
+	 * (siehe impl/task_impl.h)
+	 */
+	template<typename T = void>
+	using task = impl::task<T>;
 };
 
 // =========================================
@@ -53,4 +76,123 @@ inline size_t get_thread_pool_size() {
 	return impl::get_thread_pool_size();
 }
 
+using queue_overflow_policy = impl::queue_overflow_policy;
+
+/**
+ * Begrenzt die Async-Task-Queue auf capacity wartende Tasks.
+ * Ohne Limit (Default) wächst die Queue bei Überlast unbegrenzt -
+ * jede wartende Task hält ihre komplette Argument-Kopie im Speicher.
+ * Abgewiesene Calls rejecten ihr JS-Promise mit QUEUE_OVERLOADED.
+ * NACH set_thread_pool_size() aufrufen!
+ *
+ * @param capacity Maximale Anzahl wartender Tasks (0 = unbegrenzt)
+ * @param policy   Verhalten bei voller Queue (Default: reject)
+ */
+inline void set_task_queue_limit(
+	size_t capacity,
+	queue_overflow_policy policy = queue_overflow_policy::reject)
+{
+	impl::set_task_queue_limit(capacity, policy);
+}
+
+/**
+ * Hochwassermarke für die Queue-Tiefe: callback(depth, true) beim
+ * Überschreiten von depth, callback(depth, false) sobald die Queue
+ * wieder unter depth/2 gefallen ist (Hysterese). Läuft auf beliebigen
+ * Threads - kurz halten! Vor dem ersten Async-Call setzen.
+ */
+inline void set_task_queue_watermark(size_t depth, std::function<void(size_t, bool)> callback) {
+	impl::set_task_queue_watermark(depth, std::move(callback));
+}
+
+/**
+ * Opts a class into the binary (CBOR) wire protocol.
+ * Must be called BEFORE register_type<T>() so the injected JS class
+ * config picks up the negotiated mode.
+ *
+ * @param class_name Exposed class name (e.g. "MyObject")
+ */
+inline void enable_binary_protocol(std::string_view class_name) {
+	impl::set_wire_format(class_name, impl::wire_format::cbor);
+}
+
+/**
+ * Minimum serialized payload size (bytes of JSON text) before a value
+ * travels as a CBOR envelope. 0 disables binary encoding (default).
+ * Small calls always keep the plain JSON path.
+ */
+inline void set_binary_wire_threshold(size_t bytes) {
+	impl::set_binary_wire_threshold(bytes);
+}
+
+/**
+ * Minimum serialized payload size before a value leaves the bind
+ * channel entirely: the bytes are parked in the blob store and JS
+ * fetches them as an ArrayBuffer via the ResourceServer.
+ * 0 disables blob offload (default).
+ */
+inline void set_blob_offload_threshold(size_t bytes) {
+	impl::set_blob_offload_threshold(bytes);
+}
+
+/**
+ * Minimum request payload size (bytes of JSON text) before the
+ * dispatcher parses it via simdjson instead of nlohmann (see
+ * impl/fast_parse.h). 0 disables the SIMD path entirely.
+ * Default: 256 KiB.
+ */
+inline void set_simd_parse_threshold(size_t bytes) {
+	impl::set_simd_parse_threshold(bytes);
+}
+
+using task_priority = impl::task_priority;
+using cancellation_token = impl::cancellation_token;
+
+/** Coroutine-Rückgabetyp, auch außerhalb von object-Klassen nutzbar. */
+template<typename T = void>
+using task = impl::task<T>;
+
+/**
+ * Token des gerade laufenden Async-Calls (thread-local).
+ * Lange Methoden sollten regelmäßig token.cancelled() prüfen und
+ * abbrechen, statt den Worker-Thread zu blockieren.
+ */
+inline cancellation_token current_cancellation_token() {
+	return impl::current_cancellation_token();
+}
+
+/**
+ * Teilt ein in Fenster from registriertes Objekt explizit in das
+ * Fenster to. Jedes Fenster dispatcht gegen seine eigene Registry;
+ * dieses Handle-Sharing ist der einzige Weg, dasselbe C++-Objekt aus
+ * mehreren Fenstern anzusprechen.
+ *
+ * @return Das neue Objekt-Handle für die JS-Seite von to
+ *         (leerer String, wenn object_id in from unbekannt ist)
+ */
+inline std::string share_object(
+	webview::webview* from,
+	webview::webview* to,
+	std::string_view object_id)
+{
+	return impl::bridge_context::for_webview(to).share_from(
+		impl::bridge_context::for_webview(from), object_id);
+}
+
+using event_overflow_policy = impl::event_overflow_policy;
+
+/**
+ * Konfiguriert den Event-Ringpuffer für High-Frequency-Events.
+ * Muss vor dem ersten emit() aufgerufen werden!
+ *
+ * @param capacity Ringpuffer-Kapazität (wird auf Zweierpotenz aufgerundet)
+ * @param policy   Verhalten bei Überlauf (Default: drop_oldest)
+ */
+inline void set_event_channel_capacity(
+	size_t capacity,
+	event_overflow_policy policy = event_overflow_policy::drop_oldest)
+{
+	impl::event_channel::instance().configure(capacity, policy);
+}
+
 }
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "impl/trace.h"
+#include <string>
+
+namespace webbridge {
+
+/**
+ * Startet das Span-Tracing der Bridge (Dispatch, Thread-Pool,
+ * Notifications). Die Instrumentierung ist immer einkompiliert und
+ * kostet deaktiviert nur einen atomic load pro Span - trace_start()
+ * kann also auch in Produktions-Builds z.B. per Umgebungsvariable
+ * eingeschaltet werden.
+ *
+ * @param output_path Zieldatei; wird bei trace_stop() als
+ *                    chrome://tracing-kompatibles JSON geschrieben
+ */
+inline void trace_start(const std::string& output_path) {
+	impl::trace_start(output_path);
+}
+
+/**
+ * Stoppt das Tracing und schreibt die Trace-Datei. Die Datei lässt
+ * sich direkt in chrome://tracing oder https://ui.perfetto.dev laden.
+ */
+inline void trace_stop() {
+	impl::trace_stop();
+}
+
+}
@@ -0,0 +1,234 @@
+/**
+ * WebBridge Microbenchmarks
+ *
+ * Konsolen-Target für die echten Hot-Paths der Bridge. Die Zahlen in
+ * doc/performance.md stammen bisher aus handgestoppten Läufen - dieses
+ * Target macht sie pro Commit reproduzierbar:
+ *
+ *   cmake --build build --target webbridge_bench
+ *   build/src/Release/webbridge_bench.exe
+ *
+ * Gemessen wird jeweils die Median-Zeit pro Operation über mehrere
+ * Wiederholungen, damit einzelne Scheduler-Ausreißer das Ergebnis nicht
+ * verfälschen. Kein externes Benchmark-Framework - die Pfade hier sind
+ * µs-grob, eine einfache steady_clock-Schleife reicht.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+#include <nlohmann/json.hpp>
+
+#include "webbridge/impl/binding_helpers.h"
+#include "webbridge/impl/dispatcher.h"
+#include "webbridge/impl/object_registry.h"
+#include "webbridge/impl/property_impl.h"
+#include "webbridge/impl/thread_pool.h"
+#include "webbridge/impl/wire_protocol.h"
+
+using namespace webbridge::impl;
+
+namespace {
+
+// =============================================================================
+// Harness
+// =============================================================================
+
+constexpr int REPETITIONS = 7;
+
+// Führt fn `iterations`-mal aus, wiederholt das REPETITIONS-mal und gibt
+// die Median-Zeit pro Operation in Nanosekunden aus.
+template<typename Fn>
+void bench(const char* name, size_t iterations, Fn&& fn) {
+	// Warmup: Caches/Allokatoren füllen, Lazy-Init auslösen
+	for (size_t i = 0; i < iterations / 10 + 1; ++i) {
+		fn(i);
+	}
+
+	std::vector<double> ns_per_op;
+	ns_per_op.reserve(REPETITIONS);
+
+	for (int rep = 0; rep < REPETITIONS; ++rep) {
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < iterations; ++i) {
+			fn(i);
+		}
+		auto end = std::chrono::steady_clock::now();
+		auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+		ns_per_op.push_back(static_cast<double>(ns) / static_cast<double>(iterations));
+	}
+
+	std::sort(ns_per_op.begin(), ns_per_op.end());
+	double median = ns_per_op[ns_per_op.size() / 2];
+	fmt::print("{:<48} {:>12.1f} ns/op   ({} iters x {} reps)\n",
+		name, median, iterations, REPETITIONS);
+}
+
+// Verhindert, dass der Optimizer ganze Messschleifen wegfaltet
+template<typename T>
+void do_not_optimize(const T& value) {
+	volatile auto sink = &value;
+	(void)sink;
+}
+
+// =============================================================================
+// Fixtures
+// =============================================================================
+
+struct bench_object {
+	property<int> counter{0};
+	std::string name = "bench";
+};
+
+nlohmann::json make_pod_payload() {
+	return {
+		{"name", "benchmark"},
+		{"value", 42},
+		{"active", true},
+		{"ratio", 3.14159}
+	};
+}
+
+nlohmann::json make_vector_payload(size_t n) {
+	std::vector<int> data(n);
+	for (size_t i = 0; i < n; ++i) {
+		data[i] = static_cast<int>(i);
+	}
+	return nlohmann::json(data);
+}
+
+} // namespace
+
+int main() {
+	fmt::print("webbridge microbenchmarks\n");
+	fmt::print("=========================\n\n");
+
+	// -------------------------------------------------------------------------
+	// dispatcher_registry::get_handler
+	// -------------------------------------------------------------------------
+	register_class_handler(
+		"BenchObject",
+		[](object_registry&, std::string_view, std::string_view,
+			std::string_view, const nlohmann::json&)
+			-> std::tuple<int, std::string> { return {0, "null"}; },
+		[](webview::webview&, object_registry&, const std::string&,
+			std::string_view, std::string_view, const nlohmann::json&) {},
+		[](webview::webview&, object_registry&, const nlohmann::json&) {
+			return nlohmann::json{{"id", "BenchObject_0"}};
+		}
+	);
+	auto& registry = dispatcher_registry::instance();
+	auto class_id = registry.get_handler("BenchObject").class_id;
+
+	bench("dispatcher_registry::get_handler (name)", 1'000'000, [&](size_t) {
+		do_not_optimize(registry.get_handler("BenchObject"));
+	});
+
+	bench("dispatcher_registry::get_handler (numeric id)", 1'000'000, [&](size_t) {
+		do_not_optimize(registry.get_handler(class_id));
+	});
+
+	// -------------------------------------------------------------------------
+	// object_registry::get<T>
+	// -------------------------------------------------------------------------
+	auto obj = std::make_shared<bench_object>();
+	auto object_id = object_registry::instance().register_object(obj, "BenchObject");
+
+	bench("object_registry::get<T> (hit)", 1'000'000, [&](size_t) {
+		do_not_optimize(object_registry::instance().get<bench_object>(object_id));
+	});
+
+	bench("object_registry::get<T> (stale handle)", 1'000'000, [&](size_t) {
+		do_not_optimize(object_registry::instance().get<bench_object>("BenchObject_999999999"));
+	});
+
+	// -------------------------------------------------------------------------
+	// property<T>::set
+	// -------------------------------------------------------------------------
+	bench("property<int>::set (no subscriber)", 1'000'000, [&](size_t i) {
+		obj->counter.set(static_cast<int>(i));
+	});
+
+	std::atomic<size_t> notifications{0};
+	obj->counter.set_on_changed([&](const int&) {
+		notifications.fetch_add(1, std::memory_order_relaxed);
+	});
+	bench("property<int>::set (with subscriber)", 1'000'000, [&](size_t i) {
+		obj->counter.set(static_cast<int>(i));
+	});
+	obj->counter.set_on_changed(nullptr);
+	do_not_optimize(notifications);
+
+	// -------------------------------------------------------------------------
+	// invoke_and_serialize (Success- und Error-Pfad)
+	// -------------------------------------------------------------------------
+	auto pod = make_pod_payload();
+	bench("invoke_and_serialize (pod result)", 100'000, [&](size_t) {
+		do_not_optimize(invoke_and_serialize([&] { return pod; }));
+	});
+
+	auto vec1000 = make_vector_payload(1000);
+	bench("invoke_and_serialize (1000-int vector)", 10'000, [&](size_t) {
+		do_not_optimize(invoke_and_serialize([&] { return vec1000; }));
+	});
+
+	bench("invoke_and_serialize (throwing)", 100'000, [&](size_t) {
+		do_not_optimize(invoke_and_serialize([]() -> int {
+			throw std::runtime_error("bench error");
+		}));
+	});
+
+	// -------------------------------------------------------------------------
+	// thread_pool submit/complete Latenz
+	// -------------------------------------------------------------------------
+	{
+		std::mutex m;
+		std::condition_variable cv;
+		bool done = false;
+
+		bench("thread_pool submit -> complete roundtrip", 10'000, [&](size_t) {
+			{
+				std::lock_guard lock(m);
+				done = false;
+			}
+			get_thread_pool().submit([&] {
+				std::lock_guard lock(m);
+				done = true;
+				cv.notify_one();
+			});
+			std::unique_lock lock(m);
+			cv.wait(lock, [&] { return done; });
+		});
+	}
+
+	// -------------------------------------------------------------------------
+	// JSON-Marshalling repräsentativer Payloads
+	// -------------------------------------------------------------------------
+	auto pod_text = pod.dump();
+	auto vec_text = vec1000.dump();
+
+	bench("json dump (pod)", 1'000'000, [&](size_t) {
+		do_not_optimize(pod.dump());
+	});
+	bench("json parse (pod)", 1'000'000, [&](size_t) {
+		do_not_optimize(nlohmann::json::parse(pod_text));
+	});
+	bench("json dump (1000-int vector)", 10'000, [&](size_t) {
+		do_not_optimize(vec1000.dump());
+	});
+	bench("json parse (1000-int vector)", 10'000, [&](size_t) {
+		do_not_optimize(nlohmann::json::parse(vec_text));
+	});
+	bench("json to_cbor (1000-int vector)", 10'000, [&](size_t) {
+		do_not_optimize(nlohmann::json::to_cbor(vec1000));
+	});
+
+	fmt::print("\ndone\n");
+	return 0;
+}
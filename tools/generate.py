@@ -25,8 +25,12 @@ Bis C++26 Reflection verfügbar ist, dient dieses Script als Übergangslösung.
 """
 
 import sys
+import os
+import json
+import hashlib
 import argparse
 from pathlib import Path
+from concurrent.futures import ThreadPoolExecutor
 from jinja2 import Environment, FileSystemLoader
 from tstypes import cpp_to_ts_type
 from parser import ClassInfo, parse_header
@@ -52,6 +56,115 @@ def json_names(collection):
     return '{' + ', '.join(json_strings) + '}'
 
 
+def fnv1a_64(name: str) -> int:
+    """FNV-1a 64-bit, identisch zu member_hash() in binding_helpers.h."""
+    h = 0xcbf29ce484222325
+    for byte in name.encode('utf-8'):
+        h = ((h ^ byte) * 0x100000001b3) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def check_hash_collisions(cls: ClassInfo):
+    """Stellt sicher, dass der Perfect-Hash-Dispatch kollisionsfrei ist.
+
+    Die generierten Handler springen per switch über member_hash(member)
+    (FNV-1a 64-bit). Kollidieren zwei Member-Namen derselben Tabelle,
+    wäre das generierte C++ ungültig (doppeltes case-Label) bzw. würde
+    falsch dispatchen - dann muss hier hart abgebrochen werden.
+    """
+    tables = {
+        'properties': cls.properties,
+        'constants': [c for c in cls.constants if not c.is_static],
+        'sync_methods': cls.sync_methods,
+        'async_methods': cls.async_methods,
+    }
+    for table_name, members in tables.items():
+        seen = {}
+        for member in members:
+            h = fnv1a_64(member.name)
+            if h in seen and seen[h] != member.name:
+                raise ValueError(
+                    f"FNV-1a-Hash-Kollision in {cls.name}.{table_name}: "
+                    f"'{seen[h]}' und '{member.name}' - Member umbenennen."
+                )
+            seen[h] = member.name
+
+
+# =============================================================================
+# Inkrementelle Generierung (Content-Hash-Cache)
+# =============================================================================
+
+CACHE_FILENAME = ".webbridge_gencache.json"
+
+
+def _tooling_fingerprint() -> str:
+    """Hash über Generator-Code und Templates.
+
+    Geht in jeden Eintrags-Hash mit ein: ändert sich der Generator oder
+    ein Template, ist automatisch jeder Cache-Eintrag ungültig - ohne
+    dass irgendwo eine Versionsnummer gepflegt werden müsste.
+    """
+    h = hashlib.sha256()
+    tools_dir = Path(__file__).parent
+    sources = [tools_dir / "generate.py", tools_dir / "parser.py", tools_dir / "tstypes.py"]
+    sources += sorted((tools_dir / "templates").glob("*.j2"))
+    for source in sources:
+        h.update(source.name.encode("utf-8"))
+        h.update(source.read_bytes())
+    return h.hexdigest()
+
+
+def _input_hash(header_path: str, fingerprint: str) -> str:
+    """Content-Hash eines Eingabe-Headers inklusive Tooling-Fingerprint."""
+    h = hashlib.sha256()
+    h.update(fingerprint.encode("utf-8"))
+    h.update(Path(header_path).read_bytes())
+    return h.hexdigest()
+
+
+def _load_cache(cache_path: Path) -> dict:
+    """Lädt den Cache; ein kaputter/fehlender Cache heißt nur 'alles neu'."""
+    try:
+        with open(cache_path, "r", encoding="utf-8") as f:
+            loaded = json.load(f)
+            return loaded if isinstance(loaded, dict) else {}
+    except (OSError, ValueError):
+        return {}
+
+
+def _save_cache(cache_path: Path, cache: dict):
+    with open(cache_path, "w", encoding="utf-8") as f:
+        json.dump(cache, f, indent=1, sort_keys=True)
+
+
+def _write_if_changed(path: Path, content: str) -> bool:
+    """Schreibt nur bei tatsächlicher Inhaltsänderung.
+
+    Unveränderte mtimes halten die nachgelagerten C++-Recompiles aus dem
+    inkrementellen Build heraus - der Generator darf beliebig oft laufen,
+    cl.exe sieht nur echte Änderungen.
+    """
+    try:
+        if path.read_text(encoding="utf-8") == content:
+            return False
+    except (OSError, ValueError):
+        pass
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(content)
+    return True
+
+
+def _expected_outputs(class_name: str, cpp_out: str, ts_impl_out: str) -> list:
+    """Alle Ausgabedateien, die für eine Klasse existieren müssen."""
+    outputs = []
+    if cpp_out:
+        outputs.append(Path(cpp_out) / f"{class_name}_registration.h")
+        outputs.append(Path(cpp_out) / f"{class_name}_registration.cpp")
+    if ts_impl_out:
+        outputs.append(Path(ts_impl_out) / f"{class_name}.ts")
+    return outputs
+
+
 # =============================================================================
 # Globale Jinja2-Umgebung (initialisiert einmal)
 # =============================================================================
@@ -105,12 +218,33 @@ def generate_registration_impl(cls: ClassInfo, header_path: str) -> str:
     except Exception as e:
         raise FileNotFoundError(f"Konnte Template 'registration_impl.cpp.j2' nicht laden: {e}") from e
 
+    check_hash_collisions(cls)
+
     return template.render(
         cls=cls,
         header_path=Path(header_path).name,
     )
 
 
+def generate_registration_bundle(class_names: list) -> tuple:
+    """Generiert das kombinierte Registration-Bundle (Header + Impl).
+
+    register_all_classes() registriert alle Klassen und injiziert deren
+    JS-Configs als EIN init()-Script - eine Script-Evaluation beim Start
+    statt einer pro Klasse.
+    """
+    try:
+        header_tpl = _JINJA_ENV.get_template("registration_bundle.h.j2")
+        impl_tpl = _JINJA_ENV.get_template("registration_bundle.cpp.j2")
+    except Exception as e:
+        raise FileNotFoundError(f"Konnte Bundle-Templates nicht laden: {e}") from e
+
+    return (
+        header_tpl.render(class_names=class_names),
+        impl_tpl.render(class_names=class_names),
+    )
+
+
 def generate_typescript_impl(cls: ClassInfo, header_path: str) -> str:
     """Generiert die TypeScript .ts Implementierung."""
     try:
@@ -168,14 +302,36 @@ def main():
     )
     parser.add_argument('input_path', nargs='?', help='Eingabe-Header-Datei (.h) [Einzelmodus]')
     parser.add_argument('--class-name', help='Name der zu verarbeitenden Klasse [Einzelmodus]')
-    parser.add_argument('--batch', nargs='+', metavar='FILE|CLASS', 
+    parser.add_argument('--batch', nargs='+', metavar='FILE|CLASS',
                         help='Batch-Modus: Liste von "file.h|ClassName" Paaren')
+    parser.add_argument('--bundle', nargs='+', metavar='CLASS',
+                        help='Nur das Registration-Bundle für die angegebenen Klassen erzeugen')
     parser.add_argument('--cpp_out', type=str, help='Ausgabe-Ordner für C++ Registration Header')
     parser.add_argument('--ts_impl_out', type=str, help='Ausgabe-Ordner für TypeScript Implementierung')
     parser.add_argument('--verbose', '-v', action='store_true', help='Zeige detaillierte Ausgaben')
 
     args = parser.parse_args()
 
+    # Bundle-Modus: rendert NUR das kombinierte Bundle. CMake ruft das
+    # als eigenen Schritt auf - das Bundle hängt allein von der
+    # Klassenliste ab (steht zur Configure-Zeit fest), eine Änderung in
+    # einer Klasse stößt es also nicht neu an.
+    if args.bundle:
+        if args.input_path or args.class_name or args.batch:
+            print("Fehler: --bundle ist nicht mit input_path/--class-name/--batch kombinierbar", file=sys.stderr)
+            sys.exit(1)
+        if not args.cpp_out:
+            print("Fehler: --bundle benötigt --cpp_out", file=sys.stderr)
+            sys.exit(1)
+        cpp_out_path = Path(args.cpp_out)
+        cpp_out_path.mkdir(parents=True, exist_ok=True)
+        bundle_header, bundle_impl = generate_registration_bundle(args.bundle)
+        _write_if_changed(cpp_out_path / "webbridge_registration_bundle.h", bundle_header)
+        _write_if_changed(cpp_out_path / "webbridge_registration_bundle.cpp", bundle_impl)
+        if args.verbose:
+            print(f"[OK] Registration-Bundle ({len(args.bundle)} Klassen)")
+        return
+
     # Validierung: Entweder Einzelmodus oder Batch-Modus
     if args.batch:
         if args.input_path or args.class_name:
@@ -207,16 +363,52 @@ def main():
         print("Fehler: Mindestens --cpp_out oder --ts_impl_out muss angegeben werden", file=sys.stderr)
         sys.exit(1)
 
-    # Verarbeite alle Datei/Klassen-Paare
+    # -------------------------------------------------------------------------
+    # Inkrementalität: Content-Hash pro Eingabe-Header (inkl. Tooling-
+    # Fingerprint). Unveränderte Klassen überspringen Parse UND Render
+    # komplett - der Generator darf bei jedem Build laufen, ohne bei 40
+    # Klassen eine Mehrsekunden-Steuer zu kosten.
+    # -------------------------------------------------------------------------
+    cache_dir = Path(args.cpp_out or args.ts_impl_out)
+    cache_dir.mkdir(parents=True, exist_ok=True)
+    cache_path = cache_dir / CACHE_FILENAME
+    cache = _load_cache(cache_path)
+    fingerprint = _tooling_fingerprint()
+
+    cached_count = 0
+    pending = []
+    for input_path, class_name in file_class_pairs:
+        input_hash = _input_hash(input_path, fingerprint)
+        outputs = _expected_outputs(class_name, args.cpp_out, args.ts_impl_out)
+        if cache.get(class_name) == input_hash and all(p.exists() for p in outputs):
+            cached_count += 1
+            if args.verbose:
+                print(f"[CACHE] {class_name} unverändert - übersprungen")
+            continue
+        pending.append((input_path, class_name, input_hash))
+
+    # Unabhängige Header parallel parsen: jeder parse_header()-Aufruf hat
+    # seinen eigenen tree-sitter-Parser und die eigentliche Arbeit läuft
+    # in C. Threads reichen dafür; Prozess-Spawn (gerade unter Windows)
+    # wäre teurer als der Parse selbst.
+    parse_futures = {}
+    if pending:
+        with ThreadPoolExecutor(max_workers=min(len(pending), os.cpu_count() or 4)) as pool:
+            for input_path, class_name, _ in pending:
+                parse_futures[class_name] = pool.submit(parse_header, input_path, class_name)
+
+    # Rendern und Schreiben seriell (Jinja-Umgebung ist geteilt; das
+    # Rendern ist gegen den Parse ohnehin billig)
     success_count = 0
     error_count = 0
-    
-    for input_path, class_name in file_class_pairs:
+    successful_classes = set()
+
+    for input_path, class_name, input_hash in pending:
         if args.verbose:
             print(f"Parsing: {input_path} -> {class_name}")
 
         try:
-            cls = parse_header(input_path, class_name)
+            cls = parse_futures[class_name].result()
         except ImportError as e:
             print(f"  [ERROR] webbridge_parser nicht verfügbar: {e}", file=sys.stderr)
             error_count += 1
@@ -246,20 +438,18 @@ def main():
             if args.cpp_out:
                 cpp_out_path = Path(args.cpp_out)
                 cpp_out_path.mkdir(parents=True, exist_ok=True)
-                
+
                 # Header generieren
                 reg_header_output = cpp_out_path / f"{cls.name}_registration.h"
                 reg_header_code = generate_registration_header(cls, input_path)
-                with open(reg_header_output, 'w', encoding='utf-8') as f:
-                    f.write(reg_header_code)
+                _write_if_changed(reg_header_output, reg_header_code)
                 if args.verbose:
                     print(f"    [OK] Generiert: {reg_header_output}")
-                
+
                 # Implementation generieren
                 reg_impl_output = cpp_out_path / f"{cls.name}_registration.cpp"
                 reg_impl_code = generate_registration_impl(cls, input_path)
-                with open(reg_impl_output, 'w', encoding='utf-8') as f:
-                    f.write(reg_impl_code)
+                _write_if_changed(reg_impl_output, reg_impl_code)
                 if args.verbose:
                     print(f"    [OK] Generiert: {reg_impl_output}")
 
@@ -269,12 +459,13 @@ def main():
                 ts_impl_out_path.mkdir(parents=True, exist_ok=True)
                 ts_impl_output = ts_impl_out_path / f"{cls.name}.ts"
                 ts_impl_code = generate_typescript_impl(cls, input_path)
-                with open(ts_impl_output, 'w', encoding='utf-8') as f:
-                    f.write(ts_impl_code)
+                _write_if_changed(ts_impl_output, ts_impl_code)
                 if args.verbose:
                     print(f"    [OK] Generiert: {ts_impl_output}")
-                    
+
             success_count += 1
+            successful_classes.add(cls.name)
+            cache[class_name] = input_hash
 
         except Exception as e:
             print(f"    [ERROR] Fehler bei {cls.name}: {e}", file=sys.stderr)
@@ -283,10 +474,34 @@ def main():
                 traceback.print_exc()
             error_count += 1
 
+    _save_cache(cache_path, cache)
+
+    # Bundle-Klassen in Eingabe-Reihenfolge: frisch generierte plus die
+    # aus dem Cache übersprungenen (deren Ausgaben existieren ja weiter)
+    generated_class_names = [
+        class_name for _, class_name in file_class_pairs
+        if class_name in successful_classes
+        or class_name not in {c for _, c, _ in pending}
+    ]
+
+    # Kombiniertes Registration-Bundle (Batch + C++): alle Klassen-Configs
+    # werden beim Start als EIN Script injiziert statt einem pro Klasse
+    if args.batch and args.cpp_out and generated_class_names:
+        try:
+            bundle_header, bundle_impl = generate_registration_bundle(generated_class_names)
+            cpp_out_path = Path(args.cpp_out)
+            _write_if_changed(cpp_out_path / "webbridge_registration_bundle.h", bundle_header)
+            _write_if_changed(cpp_out_path / "webbridge_registration_bundle.cpp", bundle_impl)
+            if args.verbose:
+                print(f"    [OK] Generiert: Registration-Bundle ({len(generated_class_names)} Klassen)")
+        except Exception as e:
+            print(f"    [ERROR] Fehler beim Bundle: {e}", file=sys.stderr)
+            error_count += 1
+
     # Zusammenfassung (nur im nicht-verbose Modus und bei Batch)
     if not args.verbose and len(file_class_pairs) > 1:
-        print(f"Verarbeitet: {success_count} erfolgreich, {error_count} Fehler")
-    
+        print(f"Verarbeitet: {success_count} generiert, {cached_count} aus Cache, {error_count} Fehler")
+
     if error_count > 0:
         sys.exit(1)
 
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""
+webbridge Resource-Pack-Builder
+
+Packt ein Verzeichnis (typisch große Medien-Assets wie Video-Tutorials
+oder Map-Tiles) in eine einzelne Pack-Datei, die der ResourceServer per
+Memory-Mapping zero-copy serviert - die Assets landen damit nicht mehr
+via cmrc in der .rdata-Sektion des Binaries und verlängern weder
+Build noch Link.
+
+Format (little-endian, siehe src/ResourcePack.h):
+    char     magic[4]   "WBPK"
+    uint32_t version    1
+    uint64_t index_len  Länge des JSON-Index in Bytes
+    char     index[]    {"<pfad>": [offset, size, "<etag>"], ...}
+    ...Dateidaten (Offsets relativ zum Index-Ende)...
+
+Die ETags werden hier vorberechnet (gleiches FNV-1a wie compute_etag()
+in ResourceServer.h), damit zur Laufzeit nie ein mehrere hundert MB
+großer Eintrag gehasht werden muss.
+
+Verwendung:
+    python pack_resources.py <quell_verzeichnis> <ausgabe.wbpk>
+"""
+
+import json
+import struct
+import sys
+from pathlib import Path
+
+MAGIC = b"WBPK"
+VERSION = 1
+
+
+def fnv1a_64(data: bytes) -> str:
+    """FNV-1a 64-bit, identisch zu compute_etag() in ResourceServer.h."""
+    h = 14695981039346656037
+    for byte in data:
+        h ^= byte
+        h = (h * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    return f"{h:016x}"
+
+
+def build_pack(source: Path, output: Path) -> int:
+    files = sorted(p for p in source.rglob("*") if p.is_file())
+    if not files:
+        print(f"Fehler: keine Dateien unter {source}", file=sys.stderr)
+        return 1
+
+    # Offsets sind relativ zum Index-Ende, damit der Index seine eigene
+    # Länge nicht kennen muss (kein Fixpunkt über die Offset-Breiten)
+    index = {}
+    offset = 0
+    for f in files:
+        data = f.read_bytes()
+        rel = f.relative_to(source).as_posix()
+        index[rel] = [offset, len(data), fnv1a_64(data)]
+        offset += len(data)
+
+    index_bytes = json.dumps(index, separators=(",", ":")).encode("utf-8")
+    with output.open("wb") as out:
+        out.write(MAGIC)
+        out.write(struct.pack("<I", VERSION))
+        out.write(struct.pack("<Q", len(index_bytes)))
+        out.write(index_bytes)
+        for f in files:
+            out.write(f.read_bytes())
+
+    print(f"{len(files)} Dateien, {offset} Bytes Nutzdaten -> {output}")
+    return 0
+
+
+def main() -> int:
+    if len(sys.argv) != 3:
+        print(__doc__, file=sys.stderr)
+        return 1
+
+    source = Path(sys.argv[1])
+    output = Path(sys.argv[2])
+    if not source.is_dir():
+        print(f"Fehler: {source} ist kein Verzeichnis", file=sys.stderr)
+        return 1
+
+    return build_pack(source, output)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
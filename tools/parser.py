@@ -23,6 +23,7 @@ Requirements:
     pip install tree-sitter tree-sitter-cpp
 """
 
+import re
 import sys
 from pathlib import Path
 from dataclasses import dataclass, field
@@ -73,6 +74,8 @@ class MethodInfo:
     return_type: str
     parameters: List[Tuple[str, str]]
     is_async: bool = False
+    is_task: bool = False  # Coroutine: returns webbridge::task<T>
+    priority: str = 'normal'  # Thread-pool lane: 'high', 'normal' or 'background'
 
 
 @dataclass
@@ -249,17 +252,36 @@ def _parse_method(source_code: bytes, node: Node, func_declarator: Node,
         return_type_node = next((c for c in node.children if c.type not in skip_types), None)
         return_type = _normalize_type(source_code, return_type_node) if return_type_node else 'void'
     
-    # Check for async attribute (only in field_declaration, not inline)
+    # Check for async attribute (only in field_declaration, not inline).
+    # [[async]] runs with normal priority; [[async(high)]] and
+    # [[async(background)]] select an explicit thread-pool lane.
     is_async = False
+    priority = 'normal'
     if not is_inline:
-        is_async = any('async' in _get_node_text(source_code, child)
-                       for child in node.children if child.type == 'attribute_declaration')
-    
+        for child in node.children:
+            if child.type != 'attribute_declaration':
+                continue
+            text = _get_node_text(source_code, child)
+            if 'async' in text:
+                is_async = True
+                match = re.search(r'async\s*\(\s*(high|background)\s*\)', text)
+                if match:
+                    priority = match.group(1)
+
+    # Coroutine-Methoden geben webbridge::task<T> (oder task<T> über den
+    # Alias in webbridge::object) zurück. Sie sind implizit async - das
+    # [[async]]-Attribut darf zusätzlich stehen, z.B. für die Priorität.
+    is_task = bool(re.match(r'(webbridge\s*::\s*)?task\s*<', return_type))
+    if is_task:
+        is_async = True
+
     return MethodInfo(
         name=method_name,
         return_type=return_type,
         parameters=_parse_parameters(source_code, params_node),
-        is_async=is_async
+        is_async=is_async,
+        is_task=is_task,
+        priority=priority
     )
 
 
@@ -317,6 +339,9 @@ def _extract_all_members(source_code: bytes, class_body: Node, class_info: Class
             if method:
                 if method.name == class_info.name:
                     class_info.constructors.append(method)
+                elif method.is_async:
+                    # Inline-definierte Coroutinen (task<T>) sind async
+                    class_info.async_methods.append(method)
                 else:
                     class_info.sync_methods.append(method)
             return
@@ -345,7 +370,10 @@ def _extract_all_members(source_code: bytes, class_body: Node, class_info: Class
             member_name = _get_node_text(source_code, declarator_node)
 
             # Property oder Event? (supports both old PascalCase and new snake_case)
-            if template_name in ('Property', 'property'):
+            # computed_property wird wie ein normales Property behandelt -
+            # die C++-Seite ist ohnehin read-only Richtung JS, und die
+            # binding_helpers-Overloads wählen den richtigen Pfad
+            if template_name in ('Property', 'property', 'computed_property'):
                 prop_type = 'unknown'
                 if template_args:
                     type_desc = _find_child_by_type(template_args, 'type_descriptor')
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""
+webbridge Asset Precompressor
+
+Erzeugt zur Build-Zeit gzip-Varianten (.gz) der Frontend-Dist-Dateien,
+damit der ResourceServer komprimierte Antworten ausliefern kann ohne
+pro Request zu komprimieren. Nur Text-Assets (html/js/css/json/svg)
+werden komprimiert - Bilder und Fonts sind bereits komprimiert.
+
+Verwendung:
+    python precompress.py <dist-dir>
+    python precompress.py file1.js file2.css ...
+
+Die .gz-Dateien werden deterministisch geschrieben (mtime=0, kein
+Dateiname im Header), damit wiederholte Builds identische Bytes liefern
+und cmrc/CMake keine unnötigen Rebuilds sehen.
+"""
+
+import gzip
+import sys
+from pathlib import Path
+
+# Nur Formate, bei denen gzip tatsächlich etwas bringt
+COMPRESSIBLE_SUFFIXES = {'.html', '.js', '.css', '.json', '.svg', '.map'}
+
+# Winzige Dateien lohnen den Encoding-Umweg nicht
+MIN_SIZE_BYTES = 1024
+
+
+def compress_file(path: Path) -> bool:
+    """Schreibt path.gz neben die Datei. Gibt True zurück, wenn komprimiert wurde."""
+    data = path.read_bytes()
+    if len(data) < MIN_SIZE_BYTES:
+        return False
+
+    compressed = gzip.compress(data, compresslevel=9, mtime=0)
+    if len(compressed) >= len(data):
+        # Unkomprimierbar - keine .gz-Datei, der Server fällt auf das Original zurück
+        return False
+
+    out = path.with_name(path.name + '.gz')
+    out.write_bytes(compressed)
+    print(f"  {path.name}: {len(data)} -> {len(compressed)} bytes "
+          f"({100 * len(compressed) // len(data)}%)")
+    return True
+
+
+def collect_targets(args: list[str]) -> list[Path]:
+    """Expandiert Verzeichnis-Argumente zu den komprimierbaren Dateien darin."""
+    targets = []
+    for arg in args:
+        path = Path(arg)
+        if path.is_dir():
+            for file in sorted(path.rglob('*')):
+                if file.is_file() and file.suffix in COMPRESSIBLE_SUFFIXES:
+                    targets.append(file)
+        elif path.is_file():
+            targets.append(path)
+        else:
+            print(f"Warnung: {arg} nicht gefunden, übersprungen", file=sys.stderr)
+    return targets
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+
+    targets = collect_targets(sys.argv[1:])
+    compressed = sum(1 for t in targets if compress_file(t))
+    print(f"Precompressed {compressed}/{len(targets)} assets")
+
+
+if __name__ == '__main__':
+    main()
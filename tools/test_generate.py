@@ -0,0 +1,103 @@
+"""
+Tests für generate.py - Perfect-Hash-Dispatch.
+
+Ausführen: pytest test_generate.py -v
+"""
+
+import pytest
+
+from generate import fnv1a_64, check_hash_collisions
+
+
+class TestFnv1a64:
+    """fnv1a_64 muss bitidentisch zu member_hash() in binding_helpers.h sein."""
+
+    def test_empty_string_is_offset_basis(self):
+        assert fnv1a_64("") == 0xcbf29ce484222325
+
+    def test_known_vectors(self):
+        # Referenzwerte des FNV-1a-64-Algorithmus
+        assert fnv1a_64("a") == 0xaf63dc4c8601ec8c
+        assert fnv1a_64("foobar") == 0x85944171f73967e8
+
+    def test_distinct_members_hash_differently(self):
+        names = ["value", "name", "status", "calculateAsync", "processData"]
+        hashes = {fnv1a_64(n) for n in names}
+        assert len(hashes) == len(names)
+
+
+class TestCheckHashCollisions:
+    class _Member:
+        def __init__(self, name, is_static=False):
+            self.name = name
+            self.is_static = is_static
+
+    class _Cls:
+        name = "Dummy"
+
+        def __init__(self, properties=(), constants=(), sync_methods=(), async_methods=()):
+            self.properties = list(properties)
+            self.constants = list(constants)
+            self.sync_methods = list(sync_methods)
+            self.async_methods = list(async_methods)
+
+    def test_collision_free_class_passes(self):
+        cls = self._Cls(
+            properties=[self._Member("value"), self._Member("name")],
+            sync_methods=[self._Member("reset")],
+            async_methods=[self._Member("calculateAsync")],
+        )
+        check_hash_collisions(cls)  # darf nicht werfen
+
+    def test_duplicate_hash_raises(self):
+        # Gleicher Name in derselben Tabelle ist keine Kollision
+        # (identisches case-Label wäre es schon) - hier wird eine echte
+        # Kollision simuliert, indem fnv1a_64 gepatcht wird.
+        import generate
+
+        cls = self._Cls(properties=[self._Member("aaa"), self._Member("bbb")])
+        original = generate.fnv1a_64
+        generate.fnv1a_64 = lambda name: 42
+        try:
+            with pytest.raises(ValueError, match="Hash-Kollision"):
+                check_hash_collisions(cls)
+        finally:
+            generate.fnv1a_64 = original
+
+
+class TestIncrementalHelpers:
+    """Content-Hash-Cache: nur echte Änderungen dürfen Arbeit auslösen."""
+
+    def test_write_if_changed_skips_identical_content(self, tmp_path):
+        from generate import _write_if_changed
+
+        target = tmp_path / "out.h"
+        assert _write_if_changed(target, "inhalt") is True
+        before = target.stat().st_mtime_ns
+        # Identischer Inhalt: kein Schreiben, mtime bleibt - nachgelagerte
+        # Recompiles werden nicht angestoßen
+        assert _write_if_changed(target, "inhalt") is False
+        assert target.stat().st_mtime_ns == before
+        assert _write_if_changed(target, "neu") is True
+        assert target.read_text() == "neu"
+
+    def test_input_hash_tracks_header_and_tooling(self, tmp_path):
+        from generate import _input_hash
+
+        header = tmp_path / "Obj.h"
+        header.write_text("class Obj {};")
+        h1 = _input_hash(str(header), "fp-a")
+        assert h1 == _input_hash(str(header), "fp-a")
+        # Anderer Tooling-Fingerprint bzw. anderer Header-Inhalt
+        # invalidieren den Eintrag
+        assert h1 != _input_hash(str(header), "fp-b")
+        header.write_text("class Obj { int x; };")
+        assert h1 != _input_hash(str(header), "fp-a")
+
+    def test_broken_cache_means_full_rebuild(self, tmp_path):
+        from generate import _load_cache
+
+        cache_file = tmp_path / ".webbridge_gencache.json"
+        assert _load_cache(cache_file) == {}
+        cache_file.write_text("kein json {")
+        assert _load_cache(cache_file) == {}
@@ -84,6 +84,28 @@ private:
 };
 """
 
+PRIORITY_CLASS = PROPERTY_EVENT_TEMPLATE + """
+class PriorityTest {
+public:
+    [[async]] void normalTask();
+    [[async(high)]] void quickStatus();
+    [[async(background)]] void slowExport();
+};
+"""
+
+TASK_CLASS = PROPERTY_EVENT_TEMPLATE + """
+namespace webbridge { template<typename T = void> class task {}; }
+
+class DeviceReader {
+public:
+    webbridge::task<std::string> readChannel(int channel);
+    task<> flush();
+    [[async(background)]] webbridge::task<int> slowScan();
+    [[async]] void plainAsync();
+    bool plainSync();
+};
+"""
+
 TEMPLATE_TYPES = PROPERTY_EVENT_TEMPLATE + """
 class TemplateTest {
 public:
@@ -122,6 +144,19 @@ public:
 };
 """
 
+COMPUTED_PROPERTY_CLASS = PROPERTY_EVENT_TEMPLATE + """
+template<typename T> class computed_property {};
+
+class ComputedTest {
+public:
+    property<int> counter;
+    computed_property<std::string> summary{
+        [this] { return std::string(); },
+        counter
+    };
+};
+"""
+
 NESTED_NAMESPACE = """
 #pragma once
 namespace a { namespace b { namespace c {
@@ -159,6 +194,15 @@ class TestProperties:
         prop_names = {p.name for p in result.properties}
         assert prop_names == {"publicProp", "anotherPublicProp"}
 
+    @pytest.mark.parametrize("temp_header", [COMPUTED_PROPERTY_CLASS], indirect=True, ids=["computed_property"])
+    def test_computed_properties_are_properties(self, temp_header):
+        """computed_property-Felder landen wie normale Properties im Modell."""
+        result = parse_header(str(temp_header), "ComputedTest")
+        assert result is not None
+        assert {p.name for p in result.properties} == {"counter", "summary"}
+        summary = next(p for p in result.properties if p.name == "summary")
+        assert summary.type_name == "std::string"
+
 
 # =============================================================================
 # Event Tests
@@ -200,6 +244,31 @@ class TestMethods:
         assert result is not None and len(result.async_methods) == 2
         assert {m.name for m in result.async_methods} == {"foo", "asyncMethod"}
     
+    @pytest.mark.parametrize("temp_header", [PRIORITY_CLASS], indirect=True, ids=["priority_class"])
+    def test_async_priorities(self, temp_header):
+        result = parse_header(str(temp_header), "PriorityTest")
+        assert result is not None and len(result.async_methods) == 3
+        priorities = {m.name: m.priority for m in result.async_methods}
+        assert priorities == {
+            "normalTask": "normal",
+            "quickStatus": "high",
+            "slowExport": "background",
+        }
+
+    @pytest.mark.parametrize("temp_header", [TASK_CLASS], indirect=True, ids=["task_class"])
+    def test_task_methods_are_async(self, temp_header):
+        result = parse_header(str(temp_header), "DeviceReader")
+        assert result is not None
+        async_names = {m.name for m in result.async_methods}
+        assert {"readChannel", "flush", "slowScan", "plainAsync"} <= async_names
+        assert {m.name for m in result.sync_methods} == {"plainSync"}
+        flags = {m.name: m.is_task for m in result.async_methods}
+        assert flags["readChannel"] and flags["flush"] and flags["slowScan"]
+        assert not flags["plainAsync"]
+        # [[async(...)]] priority still applies to coroutines
+        slow_scan = next(m for m in result.async_methods if m.name == "slowScan")
+        assert slow_scan.priority == "background"
+
     @pytest.mark.parametrize("temp_header", [COMPLEX_CLASS], indirect=True, ids=["complex_class"])
     def test_method_parameters(self, temp_header):
         result = parse_header(str(temp_header), "MyObject")
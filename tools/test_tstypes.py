@@ -15,16 +15,17 @@ from tstypes import cpp_to_ts_type
     ("double", "number"),
     ("bool", "boolean"),
     ("std::string", "string"),
-    ("std::vector<int>", "number[]"),
+    ("std::vector<int>", "Int32Array"),          # contiguous + numerisch => TypedArray
     ("std::vector<std::string>", "string[]"),
-    ("std::array<double, 5>", "number[]"),
+    ("std::array<double, 5>", "Float64Array"),
     ("std::map<std::string, int>", "Record<string, number>"),
     ("std::unordered_map<std::string, bool>", "Record<string, boolean>"),
-    ("std::vector<std::vector<int>>", "number[][]"),
-    ("std::map<std::string, std::vector<double>>", "Record<string, number[]>"),
+    ("std::vector<std::vector<int>>", "Int32Array[]"),   # nur die innerste Ebene ist contiguous
+    ("std::map<std::string, std::vector<double>>", "Record<string, Float64Array>"),
     ("std::map<int, int>", "unknown"),  # falscher Key
     ("std::pair<int, int>", "unknown"), # nicht unterstützt
-    ("const std::vector<int>&", "number[]"),
+    ("const std::vector<int>&", "Int32Array"),
+    ("std::deque<int>", "number[]"),    # nicht contiguous => bleibt number[]
     ("unsigned long long", "number"),
     ("nullptr_t", "null"),
 ])
@@ -77,6 +77,34 @@ SEQ_CONTAINER_MAP = {
     'std::array': 'Array',
 }
 
+# Zusammenhängende Zahlencontainer (vector/array) reisen als
+# TypedArray-Envelope über die Leitung (siehe impl/binding_helpers.h)
+# und kommen in JS als typisierte Views an - nicht als number[].
+# deque/list sind nicht contiguous und bleiben normale Arrays.
+TYPED_ARRAY_MAP = {
+    'int8_t': 'Int8Array',
+    'signed char': 'Int8Array',
+    'uint8_t': 'Uint8Array',
+    'unsigned char': 'Uint8Array',
+    'int16_t': 'Int16Array',
+    'short': 'Int16Array',
+    'short int': 'Int16Array',
+    'uint16_t': 'Uint16Array',
+    'unsigned short': 'Uint16Array',
+    'unsigned short int': 'Uint16Array',
+    'int32_t': 'Int32Array',
+    'int': 'Int32Array',
+    'signed': 'Int32Array',
+    'signed int': 'Int32Array',
+    'uint32_t': 'Uint32Array',
+    'unsigned': 'Uint32Array',
+    'unsigned int': 'Uint32Array',
+    'float': 'Float32Array',
+    'double': 'Float64Array',
+}
+
+TYPED_ARRAY_CONTAINERS = ('std::vector', 'std::array')
+
 
 ASSOC_CONTAINER_MAP = {
     'std::map': 'Record',
@@ -106,6 +134,10 @@ def cpp_to_ts_type(cpp_type: str) -> str:
             if container_name == 'std::array' and ',' in inner:
                 inner = inner[:inner.index(',')].strip()
 
+            # Contiguous + numerisch => TypedArray statt number[]
+            if container_name in TYPED_ARRAY_CONTAINERS and inner in TYPED_ARRAY_MAP:
+                return TYPED_ARRAY_MAP[inner]
+
             inner_ts = cpp_to_ts_type(inner)
             return f'{inner_ts}[]'
 